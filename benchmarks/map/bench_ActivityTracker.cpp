@@ -0,0 +1,117 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <random>
+
+#include "map/ActivityTracker.hpp"
+
+// Coste por frame de mantener la zona de cada chunk frente a los centros de actividad:
+// barrido completo chunks x centros (DynamicChunkStates original) contra ActivityTracker.
+// Uso: bench_ActivityTracker [chunksPorLado=100] [centros=100] [frames=200]
+
+namespace {
+
+constexpr int SIMULATION_DISTANCE = 6;
+constexpr int KEEP_DISTANCE = 8;
+
+// Recorrido original: distancia de cada chunk a cada centro
+size_t FullScan(const DynamicArray<ChunkCoord>& chunks, const DynamicArray<ChunkCoord>& centers) {
+    size_t active = 0;
+    for (const ChunkCoord& chunk : chunks) {
+        float minDistance = KEEP_DISTANCE * 2.0f;
+        for (const ChunkCoord& center : centers) {
+            float distance = center.euclideanDistance(chunk);
+            if (distance < minDistance) minDistance = distance;
+        }
+        if (minDistance <= SIMULATION_DISTANCE) ++active;
+    }
+    return active;
+}
+
+// Cada frame, movingPercent % de los centros da un paso aleatorio a un chunk vecino
+void RunScenario(int side, int centerCount, int frames, int movingPercent) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> position(0, side - 1);
+    std::uniform_int_distribution<int> step(-1, 1);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    DynamicArray<ChunkCoord> chunks;
+    for (int y = 0; y < side; ++y) {
+        for (int x = 0; x < side; ++x) chunks.push_back(ChunkCoord(x, y));
+    }
+
+    DynamicArray<ChunkCoord> centers;
+    ActivityTracker tracker(SIMULATION_DISTANCE, KEEP_DISTANCE);
+    for (const ChunkCoord& chunk : chunks) tracker.AddChunk(chunk);
+    while (static_cast<int>(centers.size()) < centerCount) {
+        ChunkCoord center(position(rng), position(rng));
+        if (tracker.AddCenter(center)) centers.push_back(center);
+    }
+
+    DynamicArray<ChunkCoord> moves;
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int i = 0; i < centerCount; ++i) {
+            bool moving = percent(rng) < movingPercent;
+            moves.push_back(moving ? ChunkCoord(step(rng), step(rng)) : ChunkCoord(0, 0));
+        }
+    }
+
+    // Dos centros no pueden ocupar el mismo chunk: el paso se descarta en ambos casos
+    DynamicArray<ChunkCoord> scanCenters;
+    for (const ChunkCoord& center : centers) scanCenters.push_back(center);
+
+    size_t scanActive = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int i = 0; i < centerCount; ++i) {
+            ChunkCoord next = scanCenters[i] + moves[static_cast<size_t>(frame) * centerCount + i];
+            bool occupied = false;
+            for (const ChunkCoord& other : scanCenters) occupied = occupied || other == next;
+            if (!occupied) scanCenters[i] = next;
+        }
+        scanActive = FullScan(chunks, scanCenters);
+    }
+    double scan = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    DynamicArray<ZoneEvent> events;
+    size_t eventCount = 0;
+    size_t evaluationsBefore = tracker.GetEvaluationCount();
+    start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int i = 0; i < centerCount; ++i) {
+            ChunkCoord next = centers[i] + moves[static_cast<size_t>(frame) * centerCount + i];
+            if (tracker.MoveCenter(centers[i], next)) centers[i] = next;
+        }
+        events.clear();
+        tracker.TakeEvents(events);
+        eventCount += events.size();
+    }
+    double incremental = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    size_t trackedActive = 0;
+    for (const ChunkCoord& chunk : chunks) trackedActive += tracker.GetZone(chunk) == ActivityZone::ACTIVE;
+
+    std::cout << "Centros en movimiento por frame: " << movingPercent << "%\n"
+              << "  Barrido completo: " << scan * 1e3 / frames << " ms/frame (activos: " << scanActive << ")\n"
+              << "  Incremental:      " << incremental * 1e3 / frames << " ms/frame (activos: " << trackedActive
+              << ", x" << scan / incremental << ")\n"
+              << "  Chunks evaluados/frame: " << (tracker.GetEvaluationCount() - evaluationsBefore) / frames
+              << ", eventos/frame: " << eventCount / frames << "\n";
+    if (scanActive != trackedActive) std::cout << "  ERROR: los resultados no coinciden\n";
+}
+
+}
+
+int main(int argc, char** argv) {
+    int side = argc > 1 ? std::stoi(argv[1]) : 100;
+    int centerCount = argc > 2 ? std::stoi(argv[2]) : 100;
+    int frames = argc > 3 ? std::stoi(argv[3]) : 200;
+
+    std::cout << "=== " << side * side << " chunks, " << centerCount << " centros, " << frames << " frames ===\n";
+
+    RunScenario(side, centerCount, frames, 100);
+    RunScenario(side, centerCount, frames, 10);
+    RunScenario(side, centerCount, frames, 0);
+
+    return 0;
+}
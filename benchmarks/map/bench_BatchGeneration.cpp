@@ -0,0 +1,94 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <memory>
+
+#include "map/generator/WorldGenerator.hpp"
+
+// Bloque de lado x lado chunks: generateChunk uno a uno frente a generateChunks, que reúne
+// las semillas una vez por super-región y evalúa el ruido sobre filas de chunks contiguos.
+// Comprueba que los chunks coinciden.
+// Uso: bench_BatchGeneration [lado=31] [chunkSize=64] [anchoRio=0.06]
+
+namespace {
+
+// Radios en metros: a menor radio, más celdas de semillas por chunk
+const float Radii[] = { 500.0f, 125.0f };
+
+// Mejor de varias repeticiones: el resto de procesos de la máquina mete mucho ruido
+const int Repeats = 3;
+
+uint64_t ChunkHash(const Chunk& chunk, uint64_t hash) {
+    for (uint32_t y = 0; y < chunk.getChunkSize(); ++y) {
+        const Tile* row = chunk.getRowData(y);
+        for (uint32_t x = 0; x < chunk.getChunkSize(); ++x) {
+            hash = (hash ^ static_cast<uint64_t>(row[x].getBiomeId() * 2 + (row[x].hasWater() ? 1 : 0))) * 0x100000001B3ull;
+        }
+    }
+    return hash;
+}
+
+WorldGenerator MakeGenerator(float radius, float riverWidth) {
+    LakeConfig lakes(0.01f, -0.4f, 0.003f, riverWidth);
+    return WorldGenerator(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, lakes, 12345, radius, 2.0f);
+}
+
+// Generador nuevo en cada repetición: la cache de semillas empieza vacía
+template <typename Generate>
+double BestOf(float radius, float riverWidth, Generate generate, uint64_t& hash) {
+    double best = 0.0;
+    for (int r = 0; r < Repeats; ++r) {
+        WorldGenerator generator = MakeGenerator(radius, riverWidth);
+        DynamicArray<std::unique_ptr<Chunk>> chunks;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        generate(generator, chunks);
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        if (r == 0 || seconds < best) best = seconds;
+
+        hash = 0xCBF29CE484222325ull;
+        for (const std::unique_ptr<Chunk>& chunk : chunks) hash = ChunkHash(*chunk, hash);
+    }
+    return best;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int side = argc > 1 ? std::stoi(argv[1]) : 31;
+    uint32_t chunkSize = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 64;
+    float riverWidth = argc > 3 ? std::stof(argv[3]) : 0.06f;
+
+    DynamicArray<ChunkCoord> coords;
+    coords.reserve(static_cast<size_t>(side) * side);
+    for (int y = 0; y < side; ++y) {
+        for (int x = 0; x < side; ++x) coords.push_back(ChunkCoord(x - side / 2, y - side / 2));
+    }
+
+    std::cout << "=== Bloque de " << side << "x" << side << " chunks de " << chunkSize << "x" << chunkSize
+              << " (super-regiones de " << WorldGenerator::SUPER_REGION_CHUNKS << "x"
+              << WorldGenerator::SUPER_REGION_CHUNKS << ") ===\n";
+
+    bool same = true;
+    for (float radius : Radii) {
+        uint64_t singleHash = 0, batchHash = 0;
+
+        // Se conservan todos los chunks, como al cargar el bloque en WorldSystem
+        double singleSeconds = BestOf(radius, riverWidth, [&](const WorldGenerator& generator, DynamicArray<std::unique_ptr<Chunk>>& chunks) {
+            chunks.reserve(coords.size());
+            for (const ChunkCoord& coord : coords) chunks.push_back(generator.generateChunk(coord, chunkSize));
+        }, singleHash);
+
+        double batchSeconds = BestOf(radius, riverWidth, [&](const WorldGenerator& generator, DynamicArray<std::unique_ptr<Chunk>>& chunks) {
+            chunks = generator.generateChunks(std::span<const ChunkCoord>(coords.data(), coords.size()), chunkSize);
+        }, batchHash);
+
+        std::cout << "  Radio " << radius << " m: generateChunk " << singleSeconds * 1e3 << " ms, generateChunks "
+                  << batchSeconds * 1e3 << " ms (x" << singleSeconds / batchSeconds << "), "
+                  << (singleHash == batchHash ? "mismos chunks" : "CHUNKS DISTINTOS") << "\n";
+
+        same = same && singleHash == batchHash;
+    }
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <memory>
+
+#include "map/generator/WorldGenerator.hpp"
+
+// Generación de chunks con la asignación de biomas exhaustiva (todas las semillas en
+// cada tile) frente a la poda por bloques de 8x8 y a la poda jerárquica (regiones de
+// 32x32, bloques de una sola semilla rellenados). Comprueba que los biomas coinciden.
+// Uso: bench_BiomeAssignment [chunkSize=128] [chunks=100]
+
+namespace {
+
+// El radio controla cuántas semillas caen en el margen de cada chunk
+const float Radii[] = { 500.0f, 250.0f, 125.0f };
+
+double GenerateAll(const WorldGenerator& generator, int chunks, int side, uint32_t chunkSize,
+                   std::unique_ptr<Chunk>* out) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < chunks; ++i) {
+        out[i] = generator.generateChunk(i % side - side / 2, i / side - side / 2, chunkSize);
+    }
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+size_t CountMismatches(const std::unique_ptr<Chunk>* a, const std::unique_ptr<Chunk>* b, int chunks, uint32_t chunkSize) {
+    size_t mismatches = 0;
+    for (int i = 0; i < chunks; ++i) {
+        const Chunk& left = *a[i];
+        const Chunk& right = *b[i];
+        for (uint32_t y = 0; y < chunkSize; ++y) {
+            const Tile* rowA = left.getRowData(y);
+            const Tile* rowB = right.getRowData(y);
+            for (uint32_t x = 0; x < chunkSize; ++x) {
+                if (rowA[x].getBiomeId() != rowB[x].getBiomeId()) ++mismatches;
+            }
+        }
+    }
+    return mismatches;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 128;
+    int chunks = argc > 2 ? std::stoi(argv[2]) : 100;
+
+    int side = 1;
+    while (side * side < chunks) ++side;
+
+    std::cout << "=== Asignación de biomas: " << chunks << " chunks de " << chunkSize << "x" << chunkSize << " ===\n";
+
+    auto exhaustive = std::make_unique<std::unique_ptr<Chunk>[]>(chunks);
+    auto pruned = std::make_unique<std::unique_ptr<Chunk>[]>(chunks);
+    auto hierarchical = std::make_unique<std::unique_ptr<Chunk>[]>(chunks);
+
+    for (float radius : Radii) {
+        WorldGenerator generator(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, radius, 2.0f);
+
+        // Primera pasada para llenar la cache de semillas: se mide solo la asignación y los lagos
+        generator.setBiomePruning(false);
+        GenerateAll(generator, chunks, side, chunkSize, exhaustive.get());
+
+        double exhaustiveSeconds = GenerateAll(generator, chunks, side, chunkSize, exhaustive.get());
+        generator.setBiomePruning(true);
+        generator.setBiomeHierarchy(false);
+        double prunedSeconds = GenerateAll(generator, chunks, side, chunkSize, pruned.get());
+        generator.setBiomeHierarchy(true);
+        double hierarchicalSeconds = GenerateAll(generator, chunks, side, chunkSize, hierarchical.get());
+
+        size_t mismatches = CountMismatches(exhaustive.get(), pruned.get(), chunks, chunkSize) +
+                            CountMismatches(exhaustive.get(), hierarchical.get(), chunks, chunkSize);
+        std::cout << "  Radio " << radius << " m: exhaustiva " << exhaustiveSeconds * 1e3 / chunks
+                  << " ms/chunk, poda 8x8 " << prunedSeconds * 1e3 / chunks << " ms/chunk (x"
+                  << exhaustiveSeconds / prunedSeconds << "), jerárquica " << hierarchicalSeconds * 1e3 / chunks
+                  << " ms/chunk (x" << exhaustiveSeconds / hierarchicalSeconds << "), "
+                  << mismatches << " tiles distintos\n";
+
+        if (mismatches != 0) return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <string>
+
+#include "utils/CounterRng.hpp"
+
+// Coste por celda de abrir el generador y sacar sus 1-3 candidatas (5 valores cada una):
+// mt19937_64 sembrado por celda con distribuciones de <random> (versión anterior de
+// WorldGenerator::createCellRNG) frente a CounterRng. También la permutación de PerlinNoise.
+// Uso: bench_CellRng [celdas=1000000]
+
+namespace {
+
+struct Checksum {
+    double sum = 0.0;
+    void add(float value) { sum += value; }
+    void add(uint64_t value) { sum += static_cast<double>(value & 0xFFFF); }
+};
+
+uint64_t LegacyCellSeed(uint64_t worldSeed, int cellX, int cellY) {
+    uint64_t ux = static_cast<uint64_t>(static_cast<int64_t>(cellX));
+    uint64_t uy = static_cast<uint64_t>(static_cast<int64_t>(cellY));
+    uint64_t encodedX = (ux << 1) ^ (ux >> 63);
+    uint64_t encodedY = (uy << 1) ^ (uy >> 63);
+    return worldSeed ^ (encodedX << 32) ^ (encodedY & 0xFFFFFFFF);
+}
+
+void CellMt(uint64_t worldSeed, int cellX, int cellY, float cellSize, Checksum& checksum) {
+    std::mt19937_64 rng(LegacyCellSeed(worldSeed, cellX, cellY));
+    std::uniform_real_distribution<float> posDist(0.0f, cellSize);
+    std::uniform_real_distribution<float> strengthDist(0.5f, 2.0f);
+    std::uniform_int_distribution<size_t> biomeDist(0, 6);
+    std::uniform_int_distribution<int> countDist(1, 3);
+
+    int attempts = countDist(rng);
+    for (int i = 0; i < attempts; ++i) {
+        checksum.add(posDist(rng));
+        checksum.add(posDist(rng));
+        checksum.add(static_cast<uint64_t>(biomeDist(rng)));
+        checksum.add(strengthDist(rng));
+        checksum.add(rng());
+    }
+}
+
+void CellCounter(uint64_t worldSeed, int cellX, int cellY, float cellSize, Checksum& checksum) {
+    CounterRng rng(worldSeed, cellX, cellY);
+
+    int attempts = 1 + static_cast<int>(rng.nextBelow(3));
+    for (int i = 0; i < attempts; ++i) {
+        checksum.add(rng.nextFloat(0.0f, cellSize));
+        checksum.add(rng.nextFloat(0.0f, cellSize));
+        checksum.add(static_cast<uint64_t>(rng.nextBelow(7)));
+        checksum.add(rng.nextFloat(0.5f, 2.0f));
+        checksum.add(rng());
+    }
+}
+
+template <typename Rng, typename Below>
+void Shuffle(Rng& rng, Below below, int* p) {
+    for (int i = 0; i < 256; ++i) p[i] = i;
+    for (int i = 255; i > 0; --i) {
+        int j = below(rng, i + 1);
+        int temp = p[i];
+        p[i] = p[j];
+        p[j] = temp;
+    }
+}
+
+template <typename Cell>
+double TimeCells(Cell cell, int cells, const char* name, double referenceNs) {
+    const uint64_t worldSeed = 12345;
+    const float cellSize = 176.8f;
+    int side = 1;
+    while (side * side < cells) ++side;
+
+    Checksum checksum;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < cells; ++i) cell(worldSeed, i % side - side / 2, i / side - side / 2, cellSize, checksum);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / cells;
+
+    std::cout << "  " << name << ": " << ns << " ns/celda";
+    if (referenceNs > 0.0) std::cout << " (x" << referenceNs / ns << ")";
+    std::cout << ", suma " << checksum.sum << "\n";
+    return ns;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int cells = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    std::cout << "=== Candidatas de " << cells << " celdas ===\n";
+    double reference = TimeCells(CellMt, cells, "mt19937_64 + <random>", 0.0);
+    TimeCells(CellCounter, cells, "CounterRng", reference);
+
+    const int permutations = 20000;
+    int p[256];
+    long long checksum = 0;
+    std::cout << "=== Permutación de PerlinNoise, " << permutations << " semillas ===\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < permutations; ++s) {
+        std::mt19937_64 rng(static_cast<uint64_t>(s));
+        Shuffle(rng, [](std::mt19937_64& r, int bound) { return static_cast<int>(r() % static_cast<uint64_t>(bound)); }, p);
+        checksum += p[s & 255];
+    }
+    double mtUs = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / permutations;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < permutations; ++s) {
+        CounterRng rng(static_cast<uint64_t>(s));
+        Shuffle(rng, [](CounterRng& r, int bound) { return static_cast<int>(r.nextBelow(static_cast<uint32_t>(bound))); }, p);
+        checksum += p[s & 255];
+    }
+    double counterUs = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / permutations;
+
+    std::cout << "  mt19937_64 con %: " << mtUs << " us\n";
+    std::cout << "  CounterRng::nextBelow: " << counterUs << " us (x" << mtUs / counterUs << "), suma " << checksum << "\n";
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "map/generator/WorldGenerator.hpp"
+#include "map/manager/ChunkCodec.hpp"
+
+// Ratio de compresión y velocidad de codificación/decodificación sobre chunks generados.
+// Uso: bench_ChunkCodec [chunkSize=128] [radio=6]
+
+namespace {
+
+struct CodecResult {
+    size_t rawBytes = 0;
+    size_t encodedBytes = 0;
+    double encodeSeconds = 0.0;
+    double decodeSeconds = 0.0;
+    size_t mismatches = 0;
+};
+
+bool SameTiles(const Chunk& a, const Chunk& b) {
+    for (uint32_t y = 0; y < a.getChunkSize(); ++y) {
+        const Tile* rowA = a.getRowData(y);
+        const Tile* rowB = b.getRowData(y);
+        for (uint32_t x = 0; x < a.getChunkSize(); ++x) {
+            if (rowA[x].getBiomeId() != rowB[x].getBiomeId() || rowA[x].hasWater() != rowB[x].hasWater()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+CodecResult Run(const DynamicArray<std::unique_ptr<Chunk>>& chunks, ChunkEncoding encoding) {
+    CodecResult result;
+    DynamicArray<DynamicArray<char>> encoded(chunks.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        ChunkCodec::Encode(*chunks[i], encoding, encoded[i]);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    result.encodeSeconds = std::chrono::duration<double>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        Chunk decoded(chunks[i]->getChunkCoord(), chunks[i]->getChunkSize());
+        if (!ChunkCodec::Decode(encoded[i].data(), encoded[i].size(), encoding, decoded) ||
+            !SameTiles(*chunks[i], decoded)) {
+            ++result.mismatches;
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    result.decodeSeconds = std::chrono::duration<double>(end - start).count();
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        uint32_t size = chunks[i]->getChunkSize();
+        result.rawBytes += static_cast<size_t>(size) * size * sizeof(Tile);
+        result.encodedBytes += encoded[i].size();
+    }
+    return result;
+}
+
+void Print(const char* name, const CodecResult& r) {
+    double rawMB = r.rawBytes / (1024.0 * 1024.0);
+    std::cout << name << "\n"
+              << "  tamaño:    " << r.encodedBytes << " bytes  (ratio "
+              << static_cast<double>(r.rawBytes) / r.encodedBytes << "x)\n"
+              << "  codificar: " << r.encodeSeconds * 1000.0 << " ms  (" << rawMB / r.encodeSeconds << " MB/s)\n"
+              << "  decodificar: " << r.decodeSeconds * 1000.0 << " ms  (" << rawMB / r.decodeSeconds << " MB/s)\n";
+    if (r.mismatches != 0) std::cout << "  ERROR: " << r.mismatches << " chunks no coinciden tras decodificar\n";
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 128;
+    int radius = argc > 2 ? std::stoi(argv[2]) : 6;
+
+    DynamicArray<int> biomeIds{0, 1, 2, 3, 4, 5, 6};
+    WorldGenerator generator(biomeIds, 12345);
+
+    DynamicArray<std::unique_ptr<Chunk>> chunks;
+    for (int y = -radius; y <= radius; ++y) {
+        for (int x = -radius; x <= radius; ++x) {
+            chunks.push_back(generator.generateChunk(x, y, chunkSize));
+        }
+    }
+
+    std::cout << "=== Chunk codec: " << chunks.size() << " chunks generados de "
+              << chunkSize << "x" << chunkSize << " ===\n";
+
+    Print("RAW (versión 1)", Run(chunks, ChunkEncoding::RAW));
+    Print("RLE", Run(chunks, ChunkEncoding::RLE));
+    Print("RLE + LZ", Run(chunks, ChunkEncoding::RLE_LZ));
+
+    // Selección por chunk, como al guardar
+    size_t counts[3] = {0, 0, 0};
+    size_t rawBytes = 0;
+    size_t encodedBytes = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        DynamicArray<char> out;
+        ChunkEncoding chosen = ChunkCodec::EncodeSmallest(*chunks[i], out);
+        ++counts[static_cast<int>(chosen)];
+        rawBytes += static_cast<size_t>(chunkSize) * chunkSize * sizeof(Tile);
+        encodedBytes += out.size();
+    }
+    std::cout << "Selección por chunk\n"
+              << "  RAW: " << counts[0] << "  RLE: " << counts[1] << "  RLE + LZ: " << counts[2] << "\n"
+              << "  ratio: " << static_cast<double>(rawBytes) / encodedBytes << "x\n";
+
+    // Chunks con pocas ediciones frente a su línea base regenerada
+    const uint32_t edits = 16;
+    size_t fullBytes = 0;
+    size_t deltaBytes = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        Chunk edited(*chunks[i]);
+        for (uint32_t e = 0; e < edits; ++e) {
+            uint32_t index = static_cast<uint32_t>((i * 7919 + e * 104729) % (chunkSize * chunkSize));
+            edited.at(static_cast<int>(index % chunkSize), static_cast<int>(index / chunkSize)) = Tile(99, true);
+        }
+
+        DynamicArray<char> full;
+        DynamicArray<char> delta;
+        ChunkCodec::EncodeSmallest(edited, full);
+        bool useDelta = ChunkCodec::EncodeDelta(edited, *chunks[i], 0.25f, delta);
+        fullBytes += full.size();
+        deltaBytes += useDelta ? delta.size() : full.size();
+    }
+    std::cout << "Delta (" << edits << " tiles editados por chunk)\n"
+              << "  completo:  " << fullBytes << " bytes\n"
+              << "  delta:     " << deltaBytes << " bytes  (ratio "
+              << static_cast<double>(rawBytes) / deltaBytes << "x)\n";
+
+    return 0;
+}
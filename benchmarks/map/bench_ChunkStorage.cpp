@@ -0,0 +1,116 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <filesystem>
+
+#include "map/manager/ChunkManager.hpp"
+
+// Compara el guardado/carga por archivo contra el formato de regiones.
+// Uso: bench_ChunkStorage [chunkSize=128] [radio=15]
+
+namespace {
+
+struct StorageResult {
+    double unloadSeconds = 0.0;     // Tiempo bloqueado en el hilo principal
+    double saveSeconds = 0.0;
+    double loadSeconds = 0.0;       // Lector ifstream
+    double mappedSeconds = 0.0;     // Lector mmap
+    size_t files = 0;
+    size_t loaded = 0;
+};
+
+DynamicArray<ChunkCoord> BuildCoords(int radius) {
+    DynamicArray<ChunkCoord> coords;
+    for (int y = -radius; y <= radius; ++y) {
+        for (int x = -radius; x <= radius; ++x) {
+            coords.push_back(ChunkCoord(x, y));
+        }
+    }
+    return coords;
+}
+
+StorageResult Run(StorageFormat format, const std::string& directory, uint32_t chunkSize, const DynamicArray<ChunkCoord>& coords) {
+    std::filesystem::remove_all(directory);
+
+    StorageResult result;
+    {
+        ChunkManager manager(chunkSize, 12345);
+        manager.SetChunkDirectory(directory);
+        manager.SetStorageFormat(format);
+        manager.SetPersistPolicy(PersistPolicy::ALWAYS);    // Los chunks de prueba no están modificados
+
+        for (size_t i = 0; i < coords.size(); ++i) {
+            Tile fill(static_cast<int>(i % 7), (i % 3) == 0);
+            manager.SetChunk(coords[i], std::make_unique<Chunk>(coords[i], chunkSize, fill));
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < coords.size(); ++i) manager.eraseChunk(coords[i]);
+        auto unloaded = std::chrono::high_resolution_clock::now();
+        manager.FlushStorage();
+        auto end = std::chrono::high_resolution_clock::now();
+        result.unloadSeconds = std::chrono::duration<double>(unloaded - start).count();
+        result.saveSeconds = std::chrono::duration<double>(end - start).count();
+    }
+
+    for (int mapped = 0; mapped <= 1; ++mapped) {
+        ChunkManager manager(chunkSize, 12345);
+        manager.SetChunkDirectory(directory);
+        manager.SetStorageFormat(format);
+        manager.SetMappedReads(mapped == 1);
+
+        size_t loaded = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < coords.size(); ++i) {
+            if (manager.GetChunk(coords[i]) != nullptr) ++loaded;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        if (mapped == 1) result.mappedSeconds = seconds;
+        else result.loadSeconds = seconds;
+        result.loaded = loaded;
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.is_regular_file()) ++result.files;
+    }
+
+    std::filesystem::remove_all(directory);
+    return result;
+}
+
+void Print(const char* name, const StorageResult& r, size_t chunks, double chunkMB) {
+    std::cout << name << "\n"
+              << "  archivos:  " << r.files << "\n"
+              << "  descarga:  " << r.unloadSeconds * 1000.0 << " ms bloqueados en el hilo principal\n"
+              << "  guardado:  " << r.saveSeconds * 1000.0 << " ms  ("
+              << chunks / r.saveSeconds << " chunks/s, " << chunks * chunkMB / r.saveSeconds << " MB/s)\n"
+              << "  carga:     " << r.loadSeconds * 1000.0 << " ms  ("
+              << r.loaded / r.loadSeconds << " chunks/s, " << r.loaded * chunkMB / r.loadSeconds << " MB/s)  [ifstream]\n"
+              << "  carga:     " << r.mappedSeconds * 1000.0 << " ms  ("
+              << r.loaded / r.mappedSeconds << " chunks/s, " << r.loaded * chunkMB / r.mappedSeconds << " MB/s)  [mmap]\n";
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 128;
+    int radius = argc > 2 ? std::stoi(argv[2]) : 15;
+
+    DynamicArray<ChunkCoord> coords = BuildCoords(radius);
+    double chunkMB = static_cast<double>(chunkSize) * chunkSize * sizeof(Tile) / (1024.0 * 1024.0);
+    std::string base = (std::filesystem::temp_directory_path() / "bench_chunk_storage").string();
+
+    std::cout << "=== Chunk storage: " << coords.size() << " chunks de "
+              << chunkSize << "x" << chunkSize << " ===\n";
+
+    StorageResult perFile = Run(StorageFormat::PER_FILE, base + "/per_file", chunkSize, coords);
+    StorageResult region = Run(StorageFormat::REGION, base + "/region", chunkSize, coords);
+    std::filesystem::remove_all(base);
+
+    Print("Por archivo (chunk_X_Y.chnk)", perFile, coords.size(), chunkMB);
+    Print("Regiones (region_X_Y.rgn)", region, coords.size(), chunkMB);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <memory>
+
+#include "map/WorldSystem.hpp"
+
+// Chunks generados por segundo frente al número de workers, sobre la carga de
+// Debug_Coords de main.cpp: 31x31 chunks en anillos alrededor del origen.
+// Uso: bench_ParallelGeneration [chunkSize=128] [radio=15] [maxWorkers=hardware_concurrency]
+
+namespace {
+
+DynamicArray<ChunkCoord> RingCoords(int maxRadius) {
+    DynamicArray<ChunkCoord> coords;
+    coords.push_back(ChunkCoord(0, 0));
+
+    for (int radius = 1; radius <= maxRadius; ++radius) {
+        for (int x = -radius; x <= radius; ++x) {
+            coords.push_back(ChunkCoord(x, -radius));
+            coords.push_back(ChunkCoord(x, radius));
+        }
+        for (int y = -radius + 1; y <= radius - 1; ++y) {
+            coords.push_back(ChunkCoord(-radius, y));
+            coords.push_back(ChunkCoord(radius, y));
+        }
+    }
+    return coords;
+}
+
+std::unique_ptr<WorldSystem> MakeWorld(uint32_t chunkSize) {
+    return std::make_unique<WorldSystem>(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, chunkSize,
+                                         LakeConfig(0.01f, -0.4f), 6, 8, 500, 1);
+}
+
+void Report(const char* name, size_t chunks, double seconds, double serialSeconds) {
+    std::cout << "  " << name << ": " << seconds * 1e3 << " ms, " << chunks / seconds << " chunks/s";
+    if (serialSeconds > 0.0) std::cout << ", x" << serialSeconds / seconds << " frente a síncrono";
+    std::cout << "\n";
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 128;
+    int radius = argc > 2 ? std::stoi(argv[2]) : 15;
+
+    DynamicArray<ChunkCoord> coords = RingCoords(radius);
+    size_t hardware = std::thread::hardware_concurrency();
+    size_t maxThreads = argc > 3 ? std::stoul(argv[3]) : (hardware > 0 ? hardware : 1);
+
+    std::cout << "=== Generación de " << coords.size() << " chunks de " << chunkSize << "x" << chunkSize
+              << " (" << hardware << " hilos hardware) ===\n";
+
+    // Referencia: LoadChunk en el hilo principal, como el bucle original de main.cpp
+    double serialSeconds = 0.0;
+    {
+        auto world = MakeWorld(chunkSize);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const ChunkCoord& coord : coords) world->LoadChunk(coord);
+        serialSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        Report("Síncrono (LoadChunk)", coords.size(), serialSeconds, 0.0);
+    }
+
+    // RequestChunk + WaitForGeneration con 1, 2, 4, ... workers
+    for (size_t threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+
+        auto world = MakeWorld(chunkSize);
+        world->SetGenerationThreads(threads);
+
+        size_t callbacks = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const ChunkCoord& coord : coords) world->RequestChunk(coord, [&](Chunk&) { ++callbacks; });
+        // Peticiones repetidas: se coalescen con las que ya están en vuelo
+        for (const ChunkCoord& coord : coords) world->RequestChunk(coord);
+        world->WaitForGeneration();
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::string name = "Pool de " + std::to_string(threads) + " workers";
+        Report(name.c_str(), coords.size(), seconds, serialSeconds);
+        if (callbacks != coords.size()) {
+            std::cout << "  ERROR: " << callbacks << " callbacks para " << coords.size() << " chunks\n";
+            return 1;
+        }
+
+        if (threads == maxThreads) break;
+    }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "utils/PerlinNoise.hpp"
+#include "data_structures/DynamicArray.hpp"
+
+// Ruido de lagos de un chunk: PerlinNoise::noise tile a tile (double, 3D con z = 0)
+// contra noise2D por filas en cada nivel SIMD disponible.
+// Uso: bench_PerlinNoise [chunkSize=128] [chunks=400]
+
+namespace {
+
+const char* SimdName(NoiseSimd level) {
+    switch (level) {
+        case NoiseSimd::SSE41:  return "SSE4.1";
+        case NoiseSimd::AVX2:   return "AVX2";
+        case NoiseSimd::AVX512: return "AVX-512";
+        default:                return "Escalar";
+    }
+}
+
+// Cuenta tiles bajo el umbral para que el compilador no descarte el cálculo
+size_t LakesPerTile(PerlinNoise& noise, int chunkX, int chunkY, uint32_t chunkSize, float scale, float threshold) {
+    size_t water = 0;
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        for (uint32_t x = 0; x < chunkSize; ++x) {
+            float worldX = static_cast<float>(chunkX * static_cast<int>(chunkSize) + static_cast<int>(x));
+            float worldY = static_cast<float>(chunkY * static_cast<int>(chunkSize) + static_cast<int>(y));
+            if (noise.noise(worldX * scale, worldY * scale, 0.0f) < threshold) ++water;
+        }
+    }
+    return water;
+}
+
+size_t LakesBatch(const PerlinNoise& noise, NoiseSimd level, int chunkX, int chunkY, uint32_t chunkSize,
+                  float scale, float threshold, DynamicArray<float>& xs, DynamicArray<float>& out) {
+    for (uint32_t x = 0; x < chunkSize; ++x) {
+        xs[x] = static_cast<float>(chunkX * static_cast<int>(chunkSize) + static_cast<int>(x)) * scale;
+    }
+
+    size_t water = 0;
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        float worldY = static_cast<float>(chunkY * static_cast<int>(chunkSize) + static_cast<int>(y));
+        noise.noise2D(std::span<const float>(xs.data(), chunkSize), worldY * scale,
+                      std::span<float>(out.data(), chunkSize), level);
+        for (uint32_t x = 0; x < chunkSize; ++x) {
+            if (out[x] < threshold) ++water;
+        }
+    }
+    return water;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 128;
+    int chunks = argc > 2 ? std::stoi(argv[2]) : 400;
+
+    const float scale = 0.01f;
+    const float threshold = -0.4f;
+    PerlinNoise noise(12345);
+    int side = 1;
+    while (side * side < chunks) ++side;
+
+    std::cout << "=== Ruido de lagos: " << chunks << " chunks de " << chunkSize << "x" << chunkSize
+              << ", mejor nivel detectado: " << SimdName(PerlinNoise::simdLevel()) << " ===\n";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t referenceWater = 0;
+    for (int i = 0; i < chunks; ++i) {
+        referenceWater += LakesPerTile(noise, i % side - side / 2, i / side - side / 2, chunkSize, scale, threshold);
+    }
+    double perTile = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "  noise() por tile: " << perTile * 1e6 / chunks << " us/chunk, " << referenceWater << " tiles de agua\n";
+
+    DynamicArray<float> xs(chunkSize, 0.0f);
+    DynamicArray<float> out(chunkSize, 0.0f);
+    for (int level = 0; level <= static_cast<int>(PerlinNoise::simdLevel()); ++level) {
+        NoiseSimd simd = static_cast<NoiseSimd>(level);
+
+        start = std::chrono::high_resolution_clock::now();
+        size_t water = 0;
+        for (int i = 0; i < chunks; ++i) {
+            water += LakesBatch(noise, simd, i % side - side / 2, i / side - side / 2, chunkSize,
+                                scale, threshold, xs, out);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        // La versión float puede cambiar algún tile justo en el umbral
+        std::cout << "  noise2D " << SimdName(simd) << ": " << seconds * 1e6 / chunks << " us/chunk (x"
+                  << perTile / seconds << "), " << water << " tiles de agua\n";
+    }
+
+    return 0;
+}
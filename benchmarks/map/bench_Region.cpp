@@ -0,0 +1,81 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <filesystem>
+
+#include "map/WorldSystem.hpp"
+
+// Lectura de una ventana de tiles: bucle de WorldSystem::ReadTile contra ReadRegion.
+// Uso: bench_Region [lado=1024] [chunkSize=64] [repeticiones=10]
+
+namespace {
+
+struct RegionResult {
+    double seconds = 0.0;
+    int64_t checksum = 0;
+};
+
+template<typename Func>
+RegionResult Time(int repeats, Func&& body) {
+    RegionResult result;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < repeats; ++i) result.checksum = body();
+    auto end = std::chrono::high_resolution_clock::now();
+    result.seconds = std::chrono::duration<double>(end - start).count() / repeats;
+    return result;
+}
+
+int64_t Checksum(const DynamicArray<Tile>& tiles) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < tiles.size(); ++i) sum += tiles[i].getBiomeId() * 2 + (tiles[i].hasWater() ? 1 : 0);
+    return sum;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t side = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 1024;
+    uint32_t chunkSize = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 64;
+    int repeats = argc > 3 ? std::stoi(argv[3]) : 10;
+
+    WorldSystem world(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, chunkSize, LakeConfig());
+    world.SetChunkDirectory((std::filesystem::temp_directory_path() / "bench_region").string());
+
+    // Ventana desalineada respecto a los chunks para incluir tramos parciales
+    TileRect rect{-static_cast<int>(side) / 2 + 7, -static_cast<int>(side) / 2 + 3, side, side};
+
+    auto start = std::chrono::high_resolution_clock::now();
+    world.AcquireRegion(rect);
+    double acquire = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "=== Region " << side << "x" << side << " (chunks de " << chunkSize << "x" << chunkSize << ") ===\n"
+              << "Generacion inicial: " << acquire * 1e3 << " ms\n";
+
+    DynamicArray<Tile> tiles(rect.area(), Tile());
+
+    RegionResult perTile = Time(repeats, [&]() {
+        size_t i = 0;
+        for (int y = rect.y; y < rect.y + static_cast<int>(rect.height); ++y) {
+            for (int x = rect.x; x < rect.x + static_cast<int>(rect.width); ++x) tiles[i++] = world.ReadTile(x, y);
+        }
+        return Checksum(tiles);
+    });
+
+    RegionResult region = Time(repeats, [&]() {
+        world.ReadRegion(rect, std::span<Tile>(tiles.data(), tiles.size()));
+        return Checksum(tiles);
+    });
+
+    std::cout << "ReadTile:    " << perTile.seconds * 1e3 << " ms  (" << perTile.seconds * 1e9 / rect.area() << " ns/tile)\n"
+              << "ReadRegion:  " << region.seconds * 1e3 << " ms  (" << region.seconds * 1e9 / rect.area() << " ns/tile, x"
+              << perTile.seconds / region.seconds << ")\n";
+    if (perTile.checksum != region.checksum) std::cout << "ERROR: los resultados no coinciden\n";
+
+    // Escritura de vuelta: debe dejar el mundo intacto y marcar los chunks como modificados
+    start = std::chrono::high_resolution_clock::now();
+    world.WriteRegion(rect, std::span<const Tile>(tiles.data(), tiles.size()));
+    double write = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "WriteRegion: " << write * 1e3 << " ms\n";
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <memory>
+
+#include "map/generator/WorldGenerator.hpp"
+
+// Vuelo en línea recta: en cada paso se genera la columna de chunks que entra en vista.
+// Compara la cache de semillas sin límite con la acotada (celdas, memoria, tiempo) y
+// comprueba que las celdas descartadas y recalculadas dan los mismos biomas.
+// Uso: bench_SeedCache [pasos=600] [chunkSize=64] [altoVista=5]
+
+namespace {
+
+struct Flight {
+    double seconds = 0.0;
+    uint64_t checksum = 0;
+};
+
+uint64_t ChunkHash(const Chunk& chunk, uint64_t hash) {
+    for (uint32_t y = 0; y < chunk.getChunkSize(); ++y) {
+        const Tile* row = chunk.getRowData(y);
+        for (uint32_t x = 0; x < chunk.getChunkSize(); ++x) {
+            hash = (hash ^ static_cast<uint64_t>(row[x].getBiomeId() * 2 + (row[x].hasWater() ? 1 : 0))) * 0x100000001B3ull;
+        }
+    }
+    return hash;
+}
+
+Flight Fly(size_t capacity, int steps, uint32_t chunkSize, int viewHeight) {
+    WorldGenerator generator(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, 250.0f, 2.0f);
+    generator.getSeedCache()->setCapacity(capacity);
+    const SeedCellCache& cache = *generator.getSeedCache();
+
+    std::string name = capacity == 0 ? "Sin límite" : "Límite " + std::to_string(capacity) + " celdas";
+    std::cout << "  " << name << ":\n";
+
+    Flight flight;
+    flight.checksum = 0xCBF29CE484222325ull;
+    int report = steps / 4 > 0 ? steps / 4 : 1;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int step = 1; step <= steps; ++step) {
+        for (int y = -viewHeight / 2; y <= viewHeight / 2; ++y) {
+            flight.checksum = ChunkHash(*generator.generateChunk(step, y, chunkSize), flight.checksum);
+        }
+
+        if (step % report == 0) {
+            std::cout << "    paso " << step << ": " << cache.size() << " celdas, "
+                      << cache.memoryUsage() / 1024 << " KB, " << cache.getEvictionCount() << " descartadas\n";
+        }
+    }
+    flight.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "    " << flight.seconds * 1e3 << " ms\n";
+    return flight;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int steps = argc > 1 ? std::stoi(argv[1]) : 600;
+    uint32_t chunkSize = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 64;
+    int viewHeight = argc > 3 ? std::stoi(argv[3]) : 5;
+
+    std::cout << "=== Cache de semillas en un vuelo de " << steps << " pasos (columnas de " << viewHeight
+              << " chunks de " << chunkSize << "x" << chunkSize << ") ===\n";
+
+    Flight unbounded = Fly(0, steps, chunkSize, viewHeight);
+    Flight bounded = Fly(SeedCellCache::DEFAULT_CAPACITY, steps, chunkSize, viewHeight);
+    Flight tight = Fly(512, steps, chunkSize, viewHeight);
+
+    bool same = unbounded.checksum == bounded.checksum && unbounded.checksum == tight.checksum;
+    std::cout << "  Mismos chunks en los tres vuelos: " << (same ? "sí" : "NO") << "\n";
+    return same ? 0 : 1;
+}
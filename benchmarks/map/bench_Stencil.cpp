@@ -0,0 +1,114 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <filesystem>
+#include <algorithm>
+#include <memory>
+
+#include "map/WorldSystem.hpp"
+#include "map/manager/ChunkStencil.hpp"
+
+// Actualización de vecindad 3x3 (expansión de bioma por mayoría) sobre los chunks activos:
+// GetTile por vecino contra ChunkStencil + StencilDriver.
+// Uso: bench_Stencil [chunkSize=64] [chunksPorLado=12] [pasos=5]
+
+namespace {
+
+constexpr int MAX_BIOMES = 16;
+
+// Bioma más frecuente entre los 9 tiles; el agua se conserva
+Tile Majority(const Tile* const rows[3], int x) {
+    int counts[MAX_BIOMES] = {};
+    for (int dy = 0; dy < 3; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) ++counts[rows[dy][x + dx].getBiomeId() & (MAX_BIOMES - 1)];
+    }
+
+    int best = rows[1][x].getBiomeId() & (MAX_BIOMES - 1);
+    for (int b = 0; b < MAX_BIOMES; ++b) {
+        if (counts[b] > counts[best]) best = b;
+    }
+    return Tile(best, rows[1][x].hasWater());
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 64;
+    int chunks = argc > 2 ? std::stoi(argv[2]) : 12;
+    int steps = argc > 3 ? std::stoi(argv[3]) : 5;
+
+    auto makeWorld = [&]() {
+        auto world = std::make_unique<WorldSystem>(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, chunkSize, LakeConfig());
+        world->SetChunkDirectory((std::filesystem::temp_directory_path() / "bench_stencil").string());
+        for (int y = 0; y < chunks; ++y) {
+            for (int x = 0; x < chunks; ++x) world->AcquireChunk(ChunkCoord(x, y))->activate();
+        }
+        return world;
+    };
+
+    std::cout << "=== Vecindad 3x3: " << chunks << "x" << chunks << " chunks activos de "
+              << chunkSize << "x" << chunkSize << ", " << steps << " pasos ===\n";
+
+    int size = static_cast<int>(chunkSize);
+    size_t tiles = static_cast<size_t>(chunks) * chunks * chunkSize * chunkSize * steps;
+
+    // GetTile por vecino: el borde del área se trata fijando coordenadas al rango cargado
+    auto naiveWorld = makeWorld();
+    const WorldSystem& naiveRead = *naiveWorld;
+    int extent = chunks * size;
+    DynamicArray<Tile> back(static_cast<size_t>(extent) * extent, Tile());
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        for (int y = 0; y < extent; ++y) {
+            for (int x = 0; x < extent; ++x) {
+                Tile window[3][3];
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        int wx = std::clamp(x + dx, 0, extent - 1);
+                        int wy = std::clamp(y + dy, 0, extent - 1);
+                        window[dy + 1][dx + 1] = naiveRead.GetTile(wx, wy);
+                    }
+                }
+                const Tile* rows[3] = {window[0] + 1, window[1] + 1, window[2] + 1};
+                back[static_cast<size_t>(y) * extent + x] = Majority(rows, 0);
+            }
+        }
+        naiveWorld->WriteRegion(TileRect{0, 0, static_cast<uint32_t>(extent), static_cast<uint32_t>(extent)},
+                                std::span<const Tile>(back.data(), back.size()));
+    }
+    double naive = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    // Stencil con halo 1 y doble buffer
+    auto stencilWorld = makeWorld();
+    StencilKernel kernel = [size](const ChunkStencil& source, std::span<Tile> target) {
+        for (int y = 0; y < size; ++y) {
+            const Tile* rows[3] = {source.row(y - 1), source.row(y), source.row(y + 1)};
+            Tile* out = target.data() + static_cast<size_t>(y) * size;
+            for (int x = 0; x < size; ++x) out[x] = Majority(rows, x);
+        }
+    };
+
+    start = std::chrono::high_resolution_clock::now();
+    size_t changed = 0;
+    for (int step = 0; step < steps; ++step) {
+        stencilWorld->UpdateActiveChunks(1, kernel);
+        changed += stencilWorld->GetLastUpdateChangedTiles();
+    }
+    double stencil = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    // Ambos tratan el borde exterior replicando el tile más cercano: el resultado debe coincidir
+    size_t mismatches = 0;
+    for (int y = 0; y < extent; ++y) {
+        for (int x = 0; x < extent; ++x) {
+            if (naiveRead.GetTile(x, y) != static_cast<const WorldSystem&>(*stencilWorld).GetTile(x, y)) ++mismatches;
+        }
+    }
+
+    std::cout << "GetTile:  " << naive * 1e9 / tiles << " ns/tile\n"
+              << "Stencil:  " << stencil * 1e9 / tiles << " ns/tile  (x" << naive / stencil << ")\n"
+              << "Tiles cambiados: " << changed << "\n";
+    if (mismatches != 0) std::cout << "ERROR: " << mismatches << " tiles no coinciden\n";
+
+    return 0;
+}
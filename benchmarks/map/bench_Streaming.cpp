@@ -0,0 +1,95 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <filesystem>
+#include <algorithm>
+#include <memory>
+
+#include "map/WorldSystem.hpp"
+
+// Tiempo por frame de un centro de actividad que recorre el mundo: carga síncrona de
+// todo el radio (LoadActivityChunks + UnloadFarChunks) contra UpdateStreaming.
+// Uso: bench_Streaming [chunkSize=64] [frames=600] [chunksPorFrameDeCamara=0.1]
+
+namespace {
+
+struct FrameStats {
+    double total = 0.0;
+    double worst = 0.0;
+    size_t over16ms = 0;
+
+    void Add(double seconds) {
+        total += seconds;
+        worst = std::max(worst, seconds);
+        if (seconds > 1.0 / 60.0) ++over16ms;
+    }
+};
+
+void Print(const char* name, const FrameStats& stats, int frames, const WorldSystem& world) {
+    std::cout << name << "\n"
+              << "  Media: " << stats.total * 1e3 / frames << " ms/frame, peor frame: " << stats.worst * 1e3
+              << " ms, frames > 16.7 ms: " << stats.over16ms << "\n"
+              << "  Chunks residentes al final: " << world.GetActivityTracker().GetTrackedCount() << "\n";
+}
+
+std::unique_ptr<WorldSystem> MakeWorld(uint32_t chunkSize, const char* directory) {
+    auto world = std::make_unique<WorldSystem>(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, chunkSize,
+                                               LakeConfig(), 6, 8);
+    world->SetChunkDirectory((std::filesystem::temp_directory_path() / directory).string());
+    world->Set_Center(ChunkCoord(0, 0));
+    return world;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 64;
+    int frames = argc > 2 ? std::stoi(argv[2]) : 600;
+    double speed = argc > 3 ? std::stod(argv[3]) : 0.1;     // Chunks que avanza la cámara por frame
+
+    std::cout << "=== Centro en movimiento: " << frames << " frames, chunks de " << chunkSize << "x" << chunkSize
+              << ", " << speed << " chunks/frame ===\n";
+
+    // Carga y descarga síncronas cada vez que el centro cambia de chunk
+    auto syncWorld = MakeWorld(chunkSize, "bench_streaming_sync");
+    FrameStats sync;
+    ChunkCoord center(0, 0);
+    for (int frame = 0; frame < frames; ++frame) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        ChunkCoord next(static_cast<int>(frame * speed), 0);
+        if (frame == 0 || next != center) {
+            syncWorld->Move_Center(center, next);
+            center = next;
+            syncWorld->LoadActivityChunks();
+            syncWorld->DynamicChunkStates();
+            syncWorld->UnloadFarChunks();
+        }
+
+        sync.Add(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+    }
+    Print("Síncrono (LoadActivityChunks + UnloadFarChunks)", sync, frames, *syncWorld);
+
+    // Streaming con presupuesto por frame
+    auto streamWorld = MakeWorld(chunkSize, "bench_streaming_budget");
+    FrameStats streamed;
+    StreamingBudget budget;
+    center = ChunkCoord(0, 0);
+    for (int frame = 0; frame < frames; ++frame) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        ChunkCoord next(static_cast<int>(frame * speed), 0);
+        if (next != center) {
+            streamWorld->Move_Center(center, next);
+            center = next;
+        }
+        streamWorld->UpdateStreaming(budget);
+
+        streamed.Add(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+    }
+    Print("UpdateStreaming (4 ms, 8 cargas, 32 descargas)", streamed, frames, *streamWorld);
+    std::cout << "  Pendiente al final: " << streamWorld->GetPendingStreamChecks() << " chunks por revisar, "
+              << streamWorld->GetPendingStreamUnloads() << " descargas\n";
+
+    return 0;
+}
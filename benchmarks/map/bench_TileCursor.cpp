@@ -0,0 +1,116 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <random>
+#include <filesystem>
+
+#include "map/WorldSystem.hpp"
+#include "map/TileCursor.hpp"
+
+// Acceso a tiles en coordenadas de mundo: WorldSystem::ReadTile contra TileCursor.
+// Uso: bench_TileCursor [chunkSize=64] [chunksPorLado=8] [pasos=10000000]
+
+namespace {
+
+struct AccessResult {
+    double seconds = 0.0;
+    int64_t checksum = 0;
+};
+
+void Print(const char* name, const AccessResult& getTile, const AccessResult& cursor, size_t accesses) {
+    std::cout << name << "\n"
+              << "  ReadTile:  " << getTile.seconds * 1e9 / accesses << " ns/tile\n"
+              << "  Cursor:    " << cursor.seconds * 1e9 / accesses << " ns/tile  (x"
+              << getTile.seconds / cursor.seconds << ")\n";
+    if (getTile.checksum != cursor.checksum) std::cout << "  ERROR: los resultados no coinciden\n";
+}
+
+template<typename Func>
+AccessResult Time(Func&& body) {
+    AccessResult result;
+    auto start = std::chrono::high_resolution_clock::now();
+    result.checksum = body();
+    auto end = std::chrono::high_resolution_clock::now();
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t chunkSize = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : 64;
+    int chunks = argc > 2 ? std::stoi(argv[2]) : 8;
+    size_t steps = argc > 3 ? static_cast<size_t>(std::stoull(argv[3])) : 10000000;
+
+    WorldSystem world(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, 12345, chunkSize, LakeConfig());
+    world.SetChunkDirectory((std::filesystem::temp_directory_path() / "bench_tile_cursor").string());
+
+    // Área precargada: solo se mide el acceso, no la generación
+    int size = chunks * static_cast<int>(chunkSize);
+    int minXY = -size / 2;
+    int maxXY = minXY + size - 1;
+    for (int y = -chunks / 2; y < chunks - chunks / 2; ++y) {
+        for (int x = -chunks / 2; x < chunks - chunks / 2; ++x) {
+            world.LoadChunk(ChunkCoord(x, y));
+        }
+    }
+
+    std::cout << "=== Acceso a tiles: " << chunks << "x" << chunks << " chunks de "
+              << chunkSize << "x" << chunkSize << " ===\n";
+
+    // Recorrido por filas
+    size_t rasterTiles = static_cast<size_t>(size) * size;
+    AccessResult rasterGet = Time([&]() {
+        int64_t sum = 0;
+        for (int y = minXY; y <= maxXY; ++y) {
+            for (int x = minXY; x <= maxXY; ++x) sum += world.ReadTile(x, y).getBiomeId();
+        }
+        return sum;
+    });
+    AccessResult rasterCursor = Time([&]() {
+        int64_t sum = 0;
+        TileCursor cursor(world, minXY, minXY);
+        for (int y = minXY; y <= maxXY; ++y) {
+            cursor.MoveTo(minXY, y);
+            for (int x = minXY; x <= maxXY; ++x) {
+                sum += cursor.Get().getBiomeId();
+                cursor.Move(1, 0);
+            }
+        }
+        return sum;
+    });
+    Print("Recorrido por filas", rasterGet, rasterCursor, rasterTiles);
+
+    // Paseo aleatorio (rebota en los bordes del área precargada)
+    auto walk = [&](auto&& access) {
+        std::mt19937 rng(7);
+        int x = 0;
+        int y = 0;
+        int64_t sum = 0;
+        for (size_t i = 0; i < steps; ++i) {
+            uint32_t r = rng();
+            int dx = (r & 1) ? 1 : -1;
+            int dy = (r & 2) ? 1 : -1;
+            if (x + dx < minXY || x + dx > maxXY) dx = -dx;
+            if (y + dy < minXY || y + dy > maxXY) dy = -dy;
+            x += dx;
+            y += dy;
+            sum += access(x, y, dx, dy);
+        }
+        return sum;
+    };
+
+    AccessResult walkGet = Time([&]() {
+        return walk([&](int x, int y, int, int) { return world.ReadTile(x, y).getBiomeId(); });
+    });
+    AccessResult walkCursor = Time([&]() {
+        TileCursor cursor(world, 0, 0);
+        return walk([&](int, int, int dx, int dy) {
+            cursor.Move(dx, dy);
+            return cursor.Get().getBiomeId();
+        });
+    });
+    Print("Paseo aleatorio", walkGet, walkCursor, steps);
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include "map/manager/ChunkCord.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+// Zona de un chunk según su distancia al centro de actividad más cercano
+enum class ActivityZone : uint8_t {
+    UNTRACKED,          // Aún no registrado (solo como zona previa de un evento)
+    ACTIVE,             // distancia <= simulation_distance
+    DISTANT,            // distancia <= keep_loaded_distance
+    OUT_OF_RANGE        // Más lejos: candidato a descarga
+};
+
+struct ZoneEvent {
+    ChunkCoord coord;
+    ActivityZone previous;
+    ActivityZone current;
+};
+
+// Mantiene de forma incremental la distancia de cada chunk cargado a su centro
+// de actividad más cercano. Los centros se indexan en una rejilla de celdas de
+// keep_loaded_distance chunks; al añadir, quitar o mover un centro solo se
+// reevalúan los chunks dentro de su radio. Los cambios de zona se acumulan
+// (uno por chunk) hasta TakeEvents.
+class ActivityTracker{
+private:
+    struct Entry {
+        float distance = 0.0f;      // Por encima de keep_loaded_distance se guarda FarDistance()
+        ActivityZone zone = ActivityZone::UNTRACKED;
+    };
+
+    // ----- Atributos -----
+    Unordered_map<ChunkCoord, Entry> _chunks;
+    Unordered_map<ChunkCoord, DynamicArray<ChunkCoord>> _grid;     // Celda -> centros
+    Unordered_map<ChunkCoord, ActivityZone> _pending;              // Zona en el último TakeEvents
+    size_t _center_count = 0;
+    uint64_t _center_revision = 0;      // Cambia con cada alta, baja o movimiento de un centro
+
+    int _simulation_distance = 8;
+    int _keep_loaded_distance = 12;
+    int _cell_size = 12;
+
+    size_t _evaluations = 0;        // Chunks evaluados en total (coste acumulado)
+
+public:
+    // ----- Constructores -----
+    ActivityTracker(int simulation_distance = 8, int keep_loaded_distance = 12);
+
+    ActivityTracker(const ActivityTracker& other) = delete;
+    ActivityTracker(ActivityTracker&& other) noexcept = default;
+
+    // ----- Destructor -----
+    ~ActivityTracker() = default;
+
+    // ----- Operadores -----
+    ActivityTracker& operator=(const ActivityTracker& other) = delete;
+    ActivityTracker& operator=(ActivityTracker&& other) noexcept = default;
+
+    // ----- Métodos -----
+    // Centros
+    bool AddCenter(const ChunkCoord& center);
+    bool RemoveCenter(const ChunkCoord& center);
+    bool MoveCenter(const ChunkCoord& from, const ChunkCoord& to);
+    bool HasCenter(const ChunkCoord& center) const;
+    void GetCenters(DynamicArray<ChunkCoord>& out) const;
+    size_t GetCenterCount() const { return _center_count; }
+    uint64_t GetCenterRevision() const { return _center_revision; }
+
+    // Chunks
+    void AddChunk(const ChunkCoord& coord);
+    void RemoveChunk(const ChunkCoord& coord);
+    void Clear();
+
+    ActivityZone GetZone(const ChunkCoord& coord) const;
+    float GetDistance(const ChunkCoord& coord) const;
+    size_t GetTrackedCount() const { return _chunks.size(); }
+
+    // Cambios de zona desde la llamada anterior (solo cambios netos)
+    void TakeEvents(DynamicArray<ZoneEvent>& out);
+
+    size_t GetEvaluationCount() const { return _evaluations; }
+
+private:
+    float FarDistance() const { return static_cast<float>(_keep_loaded_distance) * 2.0f; }
+    ActivityZone ZoneFor(float distance) const;
+    ChunkCoord CellOf(const ChunkCoord& coord) const;
+
+    float NearestDistance(const ChunkCoord& coord) const;
+    float NearestDistance(const ChunkCoord& coord, const DynamicArray<ChunkCoord>& candidates) const;
+    void GatherCenters(const ChunkCoord& around, int cellRadius, DynamicArray<ChunkCoord>& out) const;
+
+    void InsertCenter(const ChunkCoord& center);
+    bool EraseCenter(const ChunkCoord& center);
+    void ApplyCenterChange(const ChunkCoord* removed, const ChunkCoord* added);
+    void SetDistance(const ChunkCoord& coord, Entry& entry, float distance);
+
+    static int FloorDiv(int value, int divisor) {
+        return (value >= 0) ? value / divisor : (value - divisor + 1) / divisor;
+    }
+};
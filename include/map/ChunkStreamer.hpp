@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include "map/manager/ChunkCord.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+
+// Límites de trabajo de streaming por frame; lo que no cabe sigue en el frame siguiente
+struct StreamingBudget {
+    double seconds = 0.004;     // Tiempo máximo por frame (<= 0: sin límite de tiempo)
+    size_t maxLoads = 8;
+    size_t maxUnloads = 32;
+    bool generateAsync = false; // Generar en el pool de workers; maxLoads limita peticiones e integraciones
+};
+
+// Cola de chunks deseados alrededor de los centros de actividad: sin duplicados
+// entre centros y en orden de espiral (por distancia al centro más cercano), para
+// que los chunks cercanos se carguen primero. Solo planifica; WorldSystem ejecuta.
+class ChunkStreamer{
+private:
+    // ----- Atributos -----
+    DynamicArray<ChunkCoord> _offsets;      // Disco de radio _radius ordenado en espiral
+    DynamicArray<ChunkCoord> _queue;
+    size_t _cursor = 0;
+    int _radius = 0;
+
+public:
+    // ----- Constructores -----
+    explicit ChunkStreamer(int loadRadius = 8);
+
+    ChunkStreamer(const ChunkStreamer& other) = delete;
+    ChunkStreamer(ChunkStreamer&& other) noexcept = default;
+
+    // ----- Destructor -----
+    ~ChunkStreamer() = default;
+
+    // ----- Operadores -----
+    ChunkStreamer& operator=(const ChunkStreamer& other) = delete;
+    ChunkStreamer& operator=(ChunkStreamer&& other) noexcept = default;
+
+    // ----- Métodos -----
+    void SetRadius(int loadRadius);
+    int GetRadius() const { return _radius; }
+
+    void SetCenters(const DynamicArray<ChunkCoord>& centers);     // Reconstruye la cola
+    void Restart() { _cursor = 0; }                                 // Volver a revisar desde el principio
+
+    // Siguiente chunk deseado (puede estar ya cargado); false al agotar la cola
+    bool Next(ChunkCoord& coord);
+
+    size_t GetQueueSize() const { return _queue.size(); }
+    size_t GetRemaining() const { return _queue.size() - _cursor; }
+
+private:
+    void BuildOffsets();
+};
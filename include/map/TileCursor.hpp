@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+
+#include "map/WorldSystem.hpp"
+#include "map/manager/Chunk.hpp"
+#include "map/manager/Tile.hpp"
+
+// Cursor de acceso a tiles en coordenadas de mundo. Guarda el chunk actual y
+// cruza los bordes por los enlaces de vecindad del chunk; solo consulta el mapa
+// cuando falta el enlace o el chunk actual pudo haberse descargado.
+class TileCursor{
+private:
+    // ----- Atributos -----
+    WorldSystem* _world = nullptr;
+    Chunk* _chunk = nullptr;
+    uint64_t _epoch = 0;            // GetUnloadEpoch() cuando se resolvió _chunk
+
+    int _worldX = 0;
+    int _worldY = 0;
+    int _localX = 0;
+    int _localY = 0;
+    int _chunk_size = 16;
+
+public:
+    // ----- Constructores -----
+    explicit TileCursor(WorldSystem& world, int worldX = 0, int worldY = 0);
+
+    TileCursor(const TileCursor& other) = default;
+    TileCursor(TileCursor&& other) noexcept = default;
+
+    // ----- Destructor -----
+    ~TileCursor() = default;
+
+    // ----- Operadores -----
+    TileCursor& operator=(const TileCursor& other) = default;
+    TileCursor& operator=(TileCursor&& other) noexcept = default;
+
+    // ----- Métodos -----
+    // Movimiento
+    void MoveTo(int worldX, int worldY) { Move(worldX - _worldX, worldY - _worldY); }
+
+    void Move(int dx, int dy) {
+        _worldX += dx;
+        _worldY += dy;
+        _localX += dx;
+        _localY += dy;
+
+        // Mismo chunk: caso común, sin salir del header
+        if (_localX < 0 || _localX >= _chunk_size || _localY < 0 || _localY >= _chunk_size) CrossBorder();
+    }
+
+    // Acceso
+    const Tile& Get() {
+        Validate();
+        return static_cast<const Chunk*>(_chunk)->getRowData(static_cast<uint32_t>(_localY))[_localX];
+    }
+
+    Tile& GetMutable() {
+        Validate();
+        return _chunk->getRowData(static_cast<uint32_t>(_localY))[_localX];     // Marca el chunk como modificado
+    }
+
+    void Set(const Tile& value) { GetMutable() = value; }
+
+    int GetWorldX() const { return _worldX; }
+    int GetWorldY() const { return _worldY; }
+    Chunk* GetChunk() { Validate(); return _chunk; }
+
+private:
+    void Validate() {
+        if (_epoch != _world->GetUnloadEpoch()) Relocate();
+    }
+
+    void CrossBorder();
+    void Relocate();
+    bool StepChunk(int dcx, int dcy);
+
+    static int FloorDiv(int value, int divisor) {
+        return (value >= 0) ? value / divisor : (value - divisor + 1) / divisor;
+    }
+};
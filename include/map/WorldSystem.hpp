@@ -1,18 +1,43 @@
 #pragma once
+#include <span>
+#include <cstdint>
+#include <memory>
+#include <future>
+#include <functional>
 
 #include "map/manager/ChunkManager.hpp"
+#include "map/manager/ChunkStencil.hpp"
 #include "map/generator/WorldGenerator.hpp"
+#include "map/generator/ChunkGenerationPool.hpp"
+#include "map/ActivityTracker.hpp"
+#include "map/ChunkStreamer.hpp"
 
 #include "map/manager/Tile.hpp"
 #include "map/manager/Chunk.hpp"
 #include "map/manager/ChunkCord.hpp"
+#include "map/manager/TileRect.hpp"
 
 #include "data_structures/Double_Linked_List.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+// Se ejecuta en el hilo dueño cuando el chunk pedido ya está residente
+using ChunkCallback = std::function<void(Chunk&)>;
 
 class WorldSystem {
 private:
+    struct ChunkRequest {
+        std::promise<Chunk*> promise;
+        std::shared_future<Chunk*> future;
+        DynamicArray<ChunkCallback> callbacks;
+    };
+
     ChunkManager _Manager;
-    WorldGenerator _Generator;
+
+    // En unique_ptr: el pool de generación guarda su dirección
+    std::unique_ptr<WorldGenerator> _Generator;
+    std::unique_ptr<ChunkGenerationPool> _Generation_Pool;     // Se crea con la primera petición
+    size_t _Generation_Threads = 0;                             // 0 = según el hardware
+    Unordered_map<ChunkCoord, ChunkRequest> _Chunk_Requests;    // Una entrada por chunk en vuelo
 
     int _simulation_distance = 8;
     int _keep_loaded_distance = 12;
@@ -20,8 +45,18 @@ private:
     float _biomeRadiusInMeters = 500;      
     float _metersPerTile = 1;
 
-    Double_Linked_List<ChunkCoord> _Activity_Centers;
-    Double_Linked_List<Chunk*> _Distant_Chunks;
+    // En unique_ptr: el aviso de residencia del manager guarda su dirección
+    std::unique_ptr<ActivityTracker> _Activity_Tracker;
+    DynamicArray<ChunkCoord> _Far_Chunks;       // Fuera de keep_loaded_distance, pendientes de descarga
+
+    ChunkStreamer _Streamer;
+    uint64_t _Stream_Center_Revision = UINT64_MAX;
+    uint64_t _Stream_Epoch = 0;
+    DynamicArray<ChunkCoord> _Streamed_In;      // Cargados en la última llamada a UpdateStreaming
+    DynamicArray<ChunkCoord> _Streamed_Out;     // Descargados en la última llamada
+    DynamicArray<ChunkCoord> _Budget_Evicted;   // Expulsados en el último EnforceMemoryBudget
+
+    StencilDriver _Stencil_Driver;
     
 public:
     // ----- Constructores -----
@@ -54,10 +89,12 @@ public:
     WorldSystem& operator=(WorldSystem&& other) noexcept;
 
     // ----- Métodos Base -----
-    Tile& GetTile(int WorldX, int WorldY);
+    Tile& GetTile(int WorldX, int WorldY);                  // Marca el chunk como modificado
     const Tile& GetTile(int WorldX, int WorldY) const;
+    const Tile& ReadTile(int WorldX, int WorldY);           // Carga o genera, sin marcar el chunk
 
     const Chunk* GetChunk(ChunkCoord coord) const;
+    Chunk* AcquireChunk(ChunkCoord coord);      // Carga o genera si no está residente
 
     void SetTile(int WorldX, int WorldY, const Tile& Value);
     void SetTile(int WorldX, int WorldY, Tile&& Value);
@@ -72,22 +109,90 @@ public:
     const DynamicArray<DynamicArray<Tile>>* LoadChunk_ptr(int WorldX, int WorldY);
 
     const uint32_t& GetChunkSize() const;
+    uint64_t GetUnloadEpoch() const { return _Manager.GetUnloadEpoch(); }
+
+    // ------ Regiones rectangulares ------
+    // out/in van fila a fila; generateMissing = false lee solo lo que ya existe
+    size_t ReadRegion(const TileRect& rect, std::span<Tile> out, bool generateMissing = true);
+    size_t ReadRegion(const TileRect& rect, std::span<Tile> out) const;
+    size_t WriteRegion(const TileRect& rect, std::span<const Tile> in);
+    void AcquireRegion(const TileRect& rect);      // Carga o genera todos los chunks que cubre rect
+
+    // ------ Generacion asincrona ------
+    // El futuro se cumple cuando el chunk se integra en el manager (IntegrateGeneratedChunks,
+    // UpdateStreaming o un acceso síncrono que lo necesite). El puntero vale mientras
+    // el chunk siga residente. Pedir un chunk ya en vuelo devuelve el mismo futuro.
+    std::shared_future<Chunk*> RequestChunk(const ChunkCoord& coord, ChunkCallback callback = nullptr);
+    size_t IntegrateGeneratedChunks(size_t maxChunks = SIZE_MAX);
+    void WaitForGeneration();           // Espera a los workers e integra todo lo pendiente
+
+    void SetGenerationThreads(size_t threads);
+    size_t GetGenerationThreads() const;
+    size_t GetPendingGenerations() const { return _Chunk_Requests.size(); }
 
     // ------ Carga y descarga masiva ------
     DynamicArray<const DynamicArray<DynamicArray<Tile>>*> loadAllChunksInVector(const DynamicArray<ChunkCoord>& Chunk_Array);
     void UnloadAllChunksInVector(const DynamicArray<ChunkCoord>&Chunk_Array);
 
     // ------ Gestion de Chunks y estados ------
-    void DynamicChunkStates();
+    void DynamicChunkStates();      // Aplica los cambios de zona pendientes del tracker
     // void CalculateCentersActivity(); 
+    const ActivityTracker& GetActivityTracker() const { return *_Activity_Tracker; }
+
+    // ------ Actualizacion por vecindad ------
+    // Aplica kernel con doble buffer a todos los chunks ACTIVE; devuelve los chunks actualizados
+    size_t UpdateActiveChunks(uint32_t halo, const StencilKernel& kernel);
+    size_t GetLastUpdateChangedTiles() const { return _Stencil_Driver.GetChangedTileCount(); }
 
     // ------ Carga y descarga automatica ------
     void UnloadFarChunks();
     void LoadActivityChunks();
 
+    // Streaming por frame: carga en espiral hasta simulation_distance y descarga
+    // lo que pase de keep_loaded_distance, sin superar el presupuesto
+    size_t UpdateStreaming(const StreamingBudget& budget = StreamingBudget());
+    const DynamicArray<ChunkCoord>& GetStreamedIn() const { return _Streamed_In; }
+    const DynamicArray<ChunkCoord>& GetStreamedOut() const { return _Streamed_Out; }
+    size_t GetPendingStreamChecks() const { return _Streamer.GetRemaining(); }
+    size_t GetPendingStreamUnloads() const { return _Far_Chunks.size(); }
+
+    // ------ Presupuesto de memoria ------
+    // Los expulsados no pasan por GetStreamedOut: quien los dibuje debe soltarlos también
+    size_t EnforceMemoryBudget(double timeBudgetSeconds);
+    const DynamicArray<ChunkCoord>& GetBudgetEvicted() const { return _Budget_Evicted; }
+    void SetMemoryBudget(size_t budgetBytes) { _Manager.SetMemoryBudget(budgetBytes); }
+    size_t GetResidentBytes() const { return _Manager.GetResidentBytes(); }
+    double GetEvictionsPerSecond() const { return _Manager.GetEvictionsPerSecond(); }
+
+    // Cache de semillas de bioma (compartida con el proveedor de baseline); 0 = sin límite
+    void SetSeedCacheCapacity(size_t maxCells) { _Generator->getSeedCache()->setCapacity(maxCells); }
+    const SeedCellCache& GetSeedCache() const { return *_Generator->getSeedCache(); }
+
+    // ------ Persistencia ------
+    void SetPersistPolicy(PersistPolicy policy) { _Manager.SetPersistPolicy(policy); }
+    void SetDeltaThreshold(float threshold) { _Manager.SetDeltaThreshold(threshold); }
+    void SetChunkDirectory(const std::string& directory) { _Manager.SetChunkDirectory(directory); }
+    void SetStorageFormat(StorageFormat format) { _Manager.SetStorageFormat(format); }
+    void FlushStorage() { _Manager.FlushStorage(); }
+
+    void SetChunkCacheBudget(size_t budgetBytes) { _Manager.SetChunkCacheBudget(budgetBytes); }
+    void SetChunkCacheCompressed(bool compressed) { _Manager.SetChunkCacheCompressed(compressed); }
+    const ChunkCache& GetChunkCache() const { return _Manager.GetChunkCache(); }
+
 // private:
     // ------ Gestion de centros de actividad ------
     void Set_Center(ChunkCoord coord);
     void Set_Erase_Center(ChunkCoord coord);
+    void Move_Center(ChunkCoord from, ChunkCoord to);
+
+private:
+    // ------ Generacion ------
+    std::unique_ptr<Chunk> GenerateChunk(const ChunkCoord& coord);
+    void GenerateMissingChunks(const DynamicArray<ChunkCoord>& coords);   // En lote con WorldGenerator::generateChunks
+    size_t IntegrateCompleted(size_t maxChunks, DynamicArray<ChunkCoord>* integrated);
+    void ResolveRequest(const ChunkCoord& coord, Chunk* chunk);
+    void InstallBaselineProvider(uint64_t worldSeed);
+    void InstallResidencyListener();
+    void SyncStreamer();
 
 };
\ No newline at end of file
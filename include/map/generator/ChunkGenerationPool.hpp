@@ -0,0 +1,86 @@
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "map/manager/Chunk.hpp"
+#include "map/manager/ChunkCord.hpp"
+#include "map/generator/WorldGenerator.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+#include "data_structures/Linked_Queue.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+// Chunk terminado por un worker, pendiente de integrarse en el hilo dueño
+struct GeneratedChunk {
+    std::unique_ptr<Chunk> chunk;
+    double seconds = 0.0;                   // Tiempo de generación medido en el worker
+};
+
+// Pool de hilos que genera chunks fuera del game loop. Un chunk ya encolado o en
+// curso no se vuelve a generar: Submit lo coalesce con la petición existente.
+class ChunkGenerationPool{
+private:
+    struct Job {
+        std::unique_ptr<Chunk> chunk;       // nullptr hasta que termina
+        double seconds = 0.0;
+        bool started = false;
+    };
+
+    // ----- Atributos -----
+    WorldGenerator* _generator;             // No es dueño
+    uint32_t _chunk_size;
+
+    DynamicArray<std::thread> _workers;
+    mutable std::mutex _mutex;
+    std::condition_variable _work_available;
+    std::condition_variable _work_done;
+
+    Unordered_map<ChunkCoord, Job> _jobs;   // Desde Submit hasta que el dueño lo recoge
+    Linked_Queue<ChunkCoord> _queue;        // Orden FIFO de generación
+    Linked_Queue<ChunkCoord> _completed;    // Orden de terminación
+
+    size_t _running = 0;
+    size_t _generated = 0;
+    bool _stop = false;
+
+public:
+    // ----- Constructores -----
+    // threadCount = 0 usa std::thread::hardware_concurrency()
+    ChunkGenerationPool(WorldGenerator* generator, uint32_t chunkSize, size_t threadCount = 0);
+
+    ChunkGenerationPool(const ChunkGenerationPool& other) = delete;
+    ChunkGenerationPool(ChunkGenerationPool&& other) = delete;
+
+    // ----- Destructor -----
+    ~ChunkGenerationPool();     // Descarta lo encolado y espera a los chunks en curso
+
+    // ----- Operadores -----
+    ChunkGenerationPool& operator=(const ChunkGenerationPool& other) = delete;
+    ChunkGenerationPool& operator=(ChunkGenerationPool&& other) = delete;
+
+    // ----- Métodos -----
+    // false si coord ya estaba en vuelo (la petición se coalesce)
+    bool Submit(const ChunkCoord& coord);
+    bool IsInFlight(const ChunkCoord& coord) const;
+
+    // Recoge hasta maxChunks chunks terminados sin bloquear
+    size_t TakeCompleted(DynamicArray<GeneratedChunk>& out, size_t maxChunks = SIZE_MAX);
+
+    // Para el hilo dueño que necesita coord ya: si ningún worker lo empezó se cancela y
+    // devuelve false (se genera en el llamante); si está en curso espera y lo entrega
+    bool Claim(const ChunkCoord& coord, GeneratedChunk& out);
+
+    // Bloquea hasta que no queda nada encolado ni en curso
+    void WaitIdle();
+
+    size_t GetThreadCount() const { return _workers.size(); }
+    size_t GetInFlightCount() const;
+    size_t GetRunningCount() const;         // Trabajos que un worker está generando ahora
+    size_t GetGeneratedCount() const;
+
+private:
+    void Run();
+};
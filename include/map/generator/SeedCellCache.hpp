@@ -0,0 +1,115 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+
+#include "data_structures/DynamicArray.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+struct BiomeSeed {
+    int biomeId;
+    float x, y;
+    float strength;
+    
+    BiomeSeed() = default;
+
+    BiomeSeed(int id, float posX, float posY, float str) 
+        : biomeId(id), x(posX), y(posY), strength(str) {}
+};
+
+// Cache de semillas por celda compartida entre hilos generadores. Las celdas son
+// función pura de (worldSeed, celda): si dos hilos calculan la misma a la vez el
+// resultado es idéntico y se conserva el primero. Repartida en shards para que
+// las lecturas concurrentes no compitan por un único lock.
+//
+// Acotada: al pasar de la capacidad un shard descarta sus celdas menos usadas
+// (LRU aproximado por shard). Una celda descartada se recalcula igual si se vuelve
+// a pedir, así que la memoria no crece al recorrer el mundo.
+class SeedCellCache{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;   // ~300 KB; 0 = sin límite
+
+private:
+    static constexpr size_t SHARD_COUNT = 64;
+
+    struct Cell {
+        DynamicArray<BiomeSeed> seeds;
+        mutable std::atomic<uint64_t> lastUse{0};   // Se actualiza bajo lock de lectura
+
+        Cell() = default;
+        Cell(DynamicArray<BiomeSeed>&& cellSeeds, uint64_t tick) : seeds(std::move(cellSeeds)), lastUse(tick) {}
+        Cell(Cell&& other) noexcept
+            : seeds(std::move(other.seeds)), lastUse(other.lastUse.load(std::memory_order_relaxed)) {}
+        Cell& operator=(Cell&& other) noexcept {
+            seeds = std::move(other.seeds);
+            lastUse.store(other.lastUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        Unordered_map<int64_t, Cell> cells;
+        size_t seedBytes = 0;               // Capacidad reservada por los arrays de semillas
+    };
+
+    // ----- Atributos -----
+    Shard _shards[SHARD_COUNT];
+
+    // Reloj de uso: avanza en cada inserción, las lecturas solo lo copian
+    std::atomic<uint64_t> _clock{0};
+    std::atomic<size_t> _capacity;
+    std::atomic<size_t> _evictions{0};
+
+public:
+    // ----- Constructores -----
+    explicit SeedCellCache(size_t capacity = DEFAULT_CAPACITY) : _capacity(capacity) {}
+
+    SeedCellCache(const SeedCellCache& other) = delete;
+    SeedCellCache(SeedCellCache&& other) = delete;
+
+    // ----- Destructor -----
+    ~SeedCellCache() = default;
+
+    // ----- Operadores -----
+    SeedCellCache& operator=(const SeedCellCache& other) = delete;
+    SeedCellCache& operator=(SeedCellCache&& other) = delete;
+
+    // ----- Métodos -----
+    // Llama a visit(const DynamicArray<BiomeSeed>&) bajo lock de lectura; false si la celda no está
+    template <typename Visitor>
+    bool visit(int64_t cellIndex, Visitor&& visit) const {
+        const Shard& shard = shardFor(cellIndex);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+        const Cell* cell = shard.cells.find_ptr(cellIndex);
+        if (cell == nullptr) return false;
+
+        // Cell::lastUse es atómico: varios lectores pueden marcarla a la vez
+        cell->lastUse.store(_clock.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        visit(cell->seeds);
+        return true;
+    }
+
+    // Las celdas vacías también se guardan: evitan repetir el cálculo
+    void insert(int64_t cellIndex, DynamicArray<BiomeSeed>&& seeds);
+    bool contains(int64_t cellIndex) const;
+
+    void clear();
+    size_t size() const;
+
+    // Máximo de celdas; al reducirla el exceso se descarta en las próximas inserciones
+    void setCapacity(size_t maxCells) { _capacity.store(maxCells, std::memory_order_relaxed); }
+    size_t capacity() const { return _capacity.load(std::memory_order_relaxed); }
+
+    size_t memoryUsage() const;     // Bytes aproximados: nodos, buckets y semillas
+    size_t getEvictionCount() const { return _evictions.load(std::memory_order_relaxed); }
+
+private:
+    void evictLeastRecent(Shard& shard, size_t keep);
+    Shard& shardFor(int64_t cellIndex);
+    const Shard& shardFor(int64_t cellIndex) const;
+    static size_t shardIndex(int64_t cellIndex);
+};
@@ -1,49 +1,49 @@
 #pragma once
 #include <memory>
 #include <cstdint>
-#include <random>
+#include <span>
 
 #include "map/manager/Chunk.hpp"
 #include "map/manager/ChunkCord.hpp"
+#include "map/generator/SeedCellCache.hpp"
 
 #include "biome/BiomeSystem.hpp"
 
 #include "utils/PerlinNoise.hpp"
+#include "utils/FractalNoise.hpp"
+#include "utils/CounterRng.hpp"
 
 #include "data_structures/DynamicArray.hpp"
 #include "data_structures/Pair.hpp"
 #include "data_structures/Unordered_map.hpp"
 
-struct BiomeSeed {
-    int biomeId;
-    float x, y;
-    float strength;
-    
-    BiomeSeed() = default;
-
-    BiomeSeed(int id, float posX, float posY, float str) 
-        : biomeId(id), x(posX), y(posY), strength(str) {}
-};
-
 struct LakeConfig {
     float scale = 0.01f;         // Escala del ruido
     float threshold = -0.4f;     // Umbral para generar lagos
+
+    // Rios: crestas de ruido ridged deformadas por domain warping (meandros)
+    float riverScale = 0.003f;   // Frecuencia de los cauces
+    float riverWidth = 0.0f;     // Franja superior de la cresta que es agua (0 = sin rios)
+    float riverMeander = 60.0f;  // Desplazamiento de los meandros en tiles
     
     LakeConfig() = default;
     LakeConfig(float scl, float thresh) 
         : scale(scl), threshold(thresh){}
+    LakeConfig(float scl, float thresh, float riverScl, float riverWdth, float meander = 60.0f)
+        : scale(scl), threshold(thresh), riverScale(riverScl), riverWidth(riverWdth), riverMeander(meander){}
 };
 
 class WorldGenerator {
 private:
     // ----- Atributos -----
     uint64_t _worldSeed;
-    std::mt19937_64 _rng;
 
     // Configuracion - Biomas (Poisson Disk)
     float _biomeRadius;                         
     float _cellSize;                            
-    Unordered_map<int64_t, DynamicArray<BiomeSeed>> _seedGrid;
+    std::shared_ptr<SeedCellCache> _seedCache;  // Compartible entre generadores con la misma configuración
+    bool _biomePruning = true;                  // Asignación por bloques con poda de semillas
+    bool _biomeHierarchy = true;                // Poda por regiones antes que por bloques
 
     // Configuracion - Lagos
     LakeConfig _lakeConfig;
@@ -52,6 +52,10 @@ private:
     // Biomas disponibles
     DynamicArray<int> _biomeIds;
 public:
+    // Aumentar cuando cambie el resultado de la generación para una misma seed y configuración:
+    // las ediciones guardadas como diferencias solo se reconstruyen con la misma versión
+    static constexpr uint32_t GENERATOR_VERSION = 1;
+
     // ----- Constructores -----
     explicit WorldGenerator(const DynamicArray<int>& biomeIds, uint64_t worldSeed = 12345, float _biomeRadiusInMeters = 500, float metersPerTile = 2.0f);
     explicit WorldGenerator(const DynamicArray<int>& biomeIds, const LakeConfig& lake_config, uint64_t worldSeed = 12345, float _biomeRadiusInMeters = 500, float metersPerTile = 2.0f);
@@ -67,9 +71,17 @@ public:
     WorldGenerator& operator=(WorldGenerator&& other) noexcept;
 
     // ----- Métodos -----
-    // Generacion
-    std::unique_ptr<Chunk> generateChunk(int chunkX, int chunkY, uint32_t chunkSize);
-    std::unique_ptr<Chunk> generateChunk(ChunkCoord coord, uint32_t chunkSize);
+    // Generacion: el resultado depende solo de la configuración y coord, no del
+    // orden de las llamadas; se puede llamar a la vez desde varios hilos
+    std::unique_ptr<Chunk> generateChunk(int chunkX, int chunkY, uint32_t chunkSize) const;
+    std::unique_ptr<Chunk> generateChunk(ChunkCoord coord, uint32_t chunkSize) const;
+
+    // Varios chunks a la vez, en el orden de coords (los repetidos se generan otra vez).
+    // Se agrupan en super-regiones de SUPER_REGION_CHUNKS x SUPER_REGION_CHUNKS: las
+    // semillas se reúnen una vez por región y el ruido se evalúa sobre las filas de
+    // chunks contiguos. El resultado es el mismo que con generateChunk.
+    static constexpr int SUPER_REGION_CHUNKS = 8;
+    DynamicArray<std::unique_ptr<Chunk>> generateChunks(std::span<const ChunkCoord> coords, uint32_t chunkSize) const;
 
     // Configuracion
     void setLakeConfig(const LakeConfig& config) { _lakeConfig = config; }
@@ -78,24 +90,91 @@ public:
     void setBiomeRadius(float radiusInMeters, float metersPerTile = 2.0f);
     float getBiomeRadius() const { return _biomeRadius; }
 
+    // Desactivada se evalúan todas las semillas en cada tile; el resultado es el mismo
+    void setBiomePruning(bool enabled) { _biomePruning = enabled; }
+    bool getBiomePruning() const { return _biomePruning; }
+
+    // Con poda, de grueso a fino: cada región de BIOME_REGION tiles filtra las semillas de
+    // sus bloques y los bloques con una sola candidata se rellenan sin evaluar tile a tile
+    void setBiomeHierarchy(bool enabled) { _biomeHierarchy = enabled; }
+    bool getBiomeHierarchy() const { return _biomeHierarchy; }
+
     uint64_t getWorldSeed() const { return _worldSeed; }
     void setWorldSeed(uint64_t worldSeed);
 
+    const DynamicArray<int>& getBiomeIds() const { return _biomeIds; }
+
+    // Los setters de configuración sustituyen la cache: no llamar mientras se genera
+    void setSeedCache(std::shared_ptr<SeedCellCache> cache) { _seedCache = std::move(cache); }
+    const std::shared_ptr<SeedCellCache>& getSeedCache() const { return _seedCache; }
+
 private:
+    // Candidata a semilla. Se acepta si ninguna candidata aceptada de mayor prioridad
+    // está a menos de _biomeRadius: equivale a colocarlas en orden de prioridad, un
+    // orden fijado por (worldSeed, celda) y no por el orden en que se piden los chunks.
+    struct SeedCandidate {
+        BiomeSeed seed;
+        uint64_t priority;
+        int64_t cellIndex;
+        int ordinal;
+    };
+
+    struct CandidateCell {
+        DynamicArray<SeedCandidate> candidates;
+        DynamicArray<int8_t> accepted;          // -1 = sin decidir
+    };
+
+    // Candidatas calculadas durante la recogida de semillas de una región
+    using CandidateMemo = Unordered_map<int64_t, CandidateCell>;
+
+    // Rectángulo de tiles de un chunk ampliado con el alcance de las semillas
+    struct SeedWindow {
+        float minTileX, minTileY, maxTileX, maxTileY;
+        float expand;
+        int startCellX, startCellY, endCellX, endCellY;
+    };
+
+    // Semillas aceptadas de un rectángulo de celdas, por filas
+    struct SeedGrid {
+        int cellX0 = 0, cellY0 = 0;
+        int width = 0, height = 0;
+        DynamicArray<DynamicArray<BiomeSeed>> cells;
+    };
+
     // ----- Metodos Poisson Disk - Biomas -----
-    // Generacion de semillas
-    void generateSeedsForRegion(const ChunkCoord& coord, uint32_t chunkSize);
-    void generateSeedsForCell(int cellX, int cellY);
-    bool isValidSeedPosition(float tileX, float tileY, int cellX, int cellY) const;
+    // Generacion de semillas (funciones puras de worldSeed y celda)
+    void generateCandidatesForCell(int cellX, int cellY, DynamicArray<SeedCandidate>& out) const;
+    void selectSeedsForCell(int cellX, int cellY, CandidateMemo& memo, DynamicArray<BiomeSeed>& out) const;
+    bool isCandidateAccepted(int cellX, int cellY, int ordinal, CandidateMemo& memo) const;
+    CandidateCell& candidateCell(int cellX, int cellY, CandidateMemo& memo) const;
+    static bool outranks(const SeedCandidate& a, const SeedCandidate& b);
+    int conflictReach() const;
 
     // Asignacion
-    void assignBiomesToChunk(Chunk& chunk);
-    DynamicArray<BiomeSeed> collectSeedsForChunk(const Chunk& chunk) const;
+    static constexpr uint32_t BIOME_BLOCK = 8;      // Lado del bloque de tiles que comparte poda
+    static constexpr uint32_t BIOME_REGION = 32;    // Lado de la región que poda para sus bloques
+
+    void assignBiomesToChunk(Chunk& chunk, const DynamicArray<BiomeSeed>& seeds) const;
+    void assignBiomesToBlock(Chunk& chunk, uint32_t blockX, uint32_t blockY, const DynamicArray<BiomeSeed>& seeds,
+                             const uint32_t* candidates, size_t candidateCount, bool fillUniform,
+                             DynamicArray<double>& upper, DynamicArray<uint32_t>& survivors) const;
+    static size_t pruneSeeds(const DynamicArray<BiomeSeed>& seeds, const uint32_t* candidates, size_t candidateCount,
+                             float minX, float minY, float maxX, float maxY, double* upper, uint32_t* out);
+    static Pair<double, double> influenceBounds(const BiomeSeed& seed, float minX, float minY, float maxX, float maxY);
+    SeedWindow seedWindow(ChunkCoord coord, uint32_t chunkSize) const;
+    void gatherSeedGrid(int startCellX, int startCellY, int endCellX, int endCellY, SeedGrid& grid) const;
+    DynamicArray<BiomeSeed> collectSeedsForChunk(const Chunk& chunk, const SeedGrid& grid) const;
     float calculateBiomeInfluence(const BiomeSeed& seed, float tileX, float tileY) const;
     int selectDominantBiome(float tileX, float tileY, const DynamicArray<BiomeSeed>& seeds) const;
 
+    // Región de chunks ya ordenada por filas (order[first, last) indexa coords)
+    void generateSuperRegion(std::span<const ChunkCoord> coords, const uint32_t* first, const uint32_t* last,
+                             uint32_t chunkSize, DynamicArray<std::unique_ptr<Chunk>>& out) const;
+
     // ----- Rios -----    
-    void generateLakes(Chunk& chunk);
+    // run: chunks consecutivos de una misma fila, de izquierda a derecha
+    void generateLakes(std::span<Chunk* const> run) const;
+    void generateRivers(std::span<Chunk* const> run) const;
     
     // ----- Helpers -----
     void updateCellSize();
@@ -103,5 +182,5 @@ private:
     Pair<int, int> worldToCellCoords(float worldX, float worldY) const;
 
     // ----- RNG -----
-    std::mt19937_64 createCellRNG(int cellX, int cellY) const;
+    CounterRng createCellRNG(int cellX, int cellY) const;
 };
\ No newline at end of file
@@ -28,13 +28,18 @@ private:
 
     uint32_t _chunk_size = 16;
     
-    Chunk* _North;
-    Chunk* _South;
-    Chunk* _East;
-    Chunk* _West;
+    Chunk* _North = nullptr;
+    Chunk* _South = nullptr;
+    Chunk* _East = nullptr;
+    Chunk* _West = nullptr;
 
     State _state = State::INITIALIZATED;
 
+    bool _dirty = false;        // Modificado desde que se generó o se cargó
+    bool _persisted = false;    // Hay una copia idéntica en disco
+
+    uint64_t _last_access = 0;  // Frame del último acceso (política de expulsión)
+
     class RowProxy;
     class ConstRowProxy;
 
@@ -81,13 +86,17 @@ public:
     _tiles(other._tiles),
     _chunkX(other._chunkX), _chunkY(other._chunkY),
     _chunk_size(other._chunk_size),
-    _state(other._state) {}
+    _state(other._state),
+    _dirty(other._dirty), _persisted(other._persisted),
+    _last_access(other._last_access) {}
 
     Chunk(Chunk&& other) noexcept :
     _tiles(std::move(other._tiles)),
     _chunkX(other._chunkX), _chunkY(other._chunkY), 
     _chunk_size(other._chunk_size),
-    _state(other._state) {
+    _state(other._state),
+    _dirty(other._dirty), _persisted(other._persisted),
+    _last_access(other._last_access) {
         other._chunkX = 0;
         other._chunkY = 0;
         other._chunk_size = 0;
@@ -105,6 +114,9 @@ public:
             _chunk_size = other._chunk_size;
             _tiles = other._tiles;
             _state = other._state;
+            _dirty = other._dirty;
+            _persisted = other._persisted;
+            _last_access = other._last_access;
         }
         return *this;
     }
@@ -116,6 +128,9 @@ public:
             _chunk_size = other._chunk_size;
             _tiles = std::move(other._tiles);
             _state = other._state;
+            _dirty = other._dirty;
+            _persisted = other._persisted;
+            _last_access = other._last_access;
 
             other._chunkX = 0;
             other._chunkY = 0;
@@ -128,13 +143,14 @@ public:
     // ----- Métodos -----
 
     // Asignacion y retorno
-    RowProxy operator[](int y) {return RowProxy(_tiles[y]); } 
+    RowProxy operator[](int y) { markDirty(); return RowProxy(_tiles[y]); } 
     ConstRowProxy operator[](int y) const {return ConstRowProxy(_tiles[y]); } 
 
     Tile& at(int x, int y){
         if(x < 0 || static_cast<uint32_t>(x) >= _chunk_size || y < 0 || static_cast<uint32_t>(y) >= _chunk_size){
             throw std::out_of_range("Coordinates out of bounds");
         }
+        markDirty();
         return _tiles[y][x];
     }
 
@@ -150,6 +166,10 @@ public:
     ChunkCoord getChunkCoord() const {return ChunkCoord(_chunkX,_chunkY); }
     uint32_t getChunkSize() const { return _chunk_size; }
 
+    // Acceso contiguo a una fila completa (serializacion)
+    Tile* getRowData(uint32_t y) { markDirty(); return _tiles[y].data(); }
+    const Tile* getRowData(uint32_t y) const { return _tiles[y].data(); }
+
     const DynamicArray<DynamicArray<Tile>>& getAllTiles() const { return _tiles; }
     const DynamicArray<DynamicArray<Tile>>* getAllTiles_ptr() const { return &_tiles; }
 
@@ -204,6 +224,17 @@ public:
     void deactivate() { _state = State::LOADED; }
     void distant() { _state = State::DISTANT; }
 
+    // Seguimiento de cambios (el acceso no const marca el chunk como modificado)
+    bool isDirty() const { return _dirty; }
+    bool isPersisted() const { return _persisted; }
+
+    void markDirty() { _dirty = true; _persisted = false; }
+    void markClean() { _dirty = false; }
+    void markPersisted() { _dirty = false; _persisted = true; }
+
+    void touch(uint64_t frame) { _last_access = frame; }
+    uint64_t getLastAccess() const { return _last_access; }
+
 
 private:
     // ----- Inicializador por defecto de Tiles -----
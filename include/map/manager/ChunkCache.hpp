@@ -0,0 +1,89 @@
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include "map/manager/Chunk.hpp"
+#include "map/manager/ChunkCord.hpp"
+#include "map/manager/ChunkFileFormat.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+#include "data_structures/Double_Linked_List.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+// Segundo nivel entre los chunks cargados y el disco: LRU de chunks descargados
+// con presupuesto en bytes. Los chunks expulsados se devuelven al llamador, que
+// decide si hay que guardarlos.
+class ChunkCache{
+private:
+    struct Entry {
+        std::unique_ptr<Chunk> chunk;           // Forma sin comprimir
+        DynamicArray<char> encoded;             // Forma comprimida
+        ChunkEncoding encoding = ChunkEncoding::RAW;
+
+        uint32_t chunkSize = 0;
+        State state = State::INITIALIZATED;
+        bool dirty = false;
+        bool persisted = false;
+
+        size_t bytes = 0;
+        Double_Linked_List<ChunkCoord>::iterator position;
+    };
+
+    // ----- Atributos -----
+    Unordered_map<ChunkCoord, Entry> _entries;
+    Double_Linked_List<ChunkCoord> _recency;    // Frente = menos usado
+
+    size_t _budget = 0;             // 0 = caché desactivada
+    size_t _used = 0;
+    bool _compressed = false;
+
+    size_t _hits = 0;
+    size_t _misses = 0;
+    size_t _evictions = 0;
+
+public:
+    // ----- Constructores -----
+    explicit ChunkCache(size_t budgetBytes = 0, bool compressed = false);
+
+    ChunkCache(const ChunkCache& other) = delete;
+    ChunkCache(ChunkCache&& other) = delete;
+
+    // ----- Destructor -----
+    ~ChunkCache() = default;
+
+    // ----- Operadores -----
+    ChunkCache& operator=(const ChunkCache& other) = delete;
+    ChunkCache& operator=(ChunkCache&& other) = delete;
+
+    // ----- Métodos -----
+    void Put(std::unique_ptr<Chunk>&& chunk, DynamicArray<std::unique_ptr<Chunk>>& evicted);
+    std::unique_ptr<Chunk> Take(const ChunkCoord& coord);
+    bool Contains(const ChunkCoord& coord) const { return _entries.find_ptr(coord) != nullptr; }
+
+    // Vacía la caché entregando todos los chunks
+    void Clear(DynamicArray<std::unique_ptr<Chunk>>& evicted);
+
+    // Copias de los chunks modificados para guardarlas; las entradas pasan a estar respaldadas
+    void CopyDirty(DynamicArray<std::unique_ptr<Chunk>>& out);
+
+    // Configuracion
+    void SetBudget(size_t budgetBytes, DynamicArray<std::unique_ptr<Chunk>>& evicted);
+    size_t GetBudget() const { return _budget; }
+
+    void SetCompressed(bool compressed, DynamicArray<std::unique_ptr<Chunk>>& evicted);
+    bool IsCompressed() const { return _compressed; }
+
+    // Estadisticas
+    size_t GetUsedBytes() const { return _used; }
+    size_t GetEntryCount() const { return _entries.size(); }
+    size_t GetHitCount() const { return _hits; }
+    size_t GetMissCount() const { return _misses; }
+    size_t GetEvictionCount() const { return _evictions; }
+
+    static size_t ChunkBytes(const Chunk& chunk);
+
+private:
+    std::unique_ptr<Chunk> Extract(const ChunkCoord& coord);
+    void EvictUntil(size_t budgetBytes, DynamicArray<std::unique_ptr<Chunk>>& evicted);
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+#include "map/manager/Chunk.hpp"
+#include "map/manager/ChunkFileFormat.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+
+// Codificación del flujo de tiles de un chunk (formato versión 2)
+class ChunkCodec{
+public:
+    // ----- Métodos -----
+    static void Encode(const Chunk& chunk, ChunkEncoding encoding, DynamicArray<char>& out);
+    static ChunkEncoding EncodeSmallest(const Chunk& chunk, DynamicArray<char>& out);
+
+    // DELTA: chunk debe contener ya la línea base regenerada
+    static bool Decode(const char* data, size_t size, ChunkEncoding encoding, Chunk& chunk);
+
+    // Diferencias respecto a la línea base; false si la fracción de tiles cambiados supera maxDensity
+    static bool EncodeDelta(const Chunk& chunk, const Chunk& baseline, float maxDensity, DynamicArray<char>& out);
+    static uint64_t HashTiles(const Chunk& chunk);
+
+private:
+    // RAW
+    static void EncodeRaw(const Chunk& chunk, DynamicArray<char>& out);
+    static bool DecodeRaw(const char* data, size_t size, Chunk& chunk);
+
+    // RLE: [varint longitud del run][varint valor del tile]
+    static void EncodeRLE(const Chunk& chunk, DynamicArray<char>& out);
+    static bool DecodeRLE(const uint8_t* data, size_t size, Chunk& chunk);
+
+    // RLE + LZ: [varint tamaño RLE][flujo LZ]
+    static void CompressRLE(const DynamicArray<char>& rle, DynamicArray<char>& out);
+    static bool DecodeRLE_LZ(const uint8_t* data, size_t size, Chunk& chunk);
+
+    // DELTA: [uint64 hash de la línea base][varint cambios]([varint salto de índice][varint tile])...
+    static bool DecodeDelta(const uint8_t* data, size_t size, Chunk& chunk);
+
+    // Helpers
+    static uint64_t PackTile(const Tile& tile);
+    static Tile UnpackTile(uint64_t value);
+
+    static void WriteVarint(DynamicArray<char>& out, uint64_t value);
+    static bool ReadVarint(const uint8_t*& ip, const uint8_t* end, uint64_t& value);
+};
@@ -63,8 +63,18 @@ public:
 namespace std {
     template<>
     struct hash<ChunkCoord> {
+        // x ^ (y << 1) de Pair colisiona mucho con coordenadas pequeñas y contiguas
+        // (una rejilla de 100x100 chunks cae en unos pocos cientos de valores):
+        // se empaquetan ambas en 64 bits y se mezclan (finalizador de splitmix64)
         size_t operator()(const ChunkCoord& coord) const {
-            return hash<Pair<int, int>>{}(coord);
+            uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(coord.x())) << 32) |
+                           static_cast<uint32_t>(coord.y());
+            key ^= key >> 30;
+            key *= 0xBF58476D1CE4E5B9ull;
+            key ^= key >> 27;
+            key *= 0x94D049BB133111EBull;
+            key ^= key >> 31;
+            return static_cast<size_t>(key);
         }
     };
 }
\ No newline at end of file
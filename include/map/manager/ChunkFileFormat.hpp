@@ -1,7 +1,16 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include "map/manager/Chunk.hpp"
 
+// Codificación del payload de tiles (formato versión 2 y 3)
+enum class ChunkEncoding : uint8_t {
+    RAW = 0,        // Tiles crudos, igual que la versión 1
+    RLE = 1,        // Runs de tiles iguales
+    RLE_LZ = 2,     // Runs de tiles + pasada LZ sobre el flujo RLE
+    DELTA = 3       // Solo los tiles que difieren de la línea base regenerada desde la seed
+};
+
 #pragma pack(push, 1)  // Ensure no padding
 struct ChunkFileHeader {
     char magic[4] = {'C', 'H', 'N', 'K'};   // Identificador mágico
@@ -13,4 +22,14 @@ struct ChunkFileHeader {
     uint32_t tileDataSize;                  // Tamaño de datos de tiles
     uint64_t seed;                          // Seed del mundo con el que fue generado el chunk
 };
+
+// Versiones 2 y 3: sigue inmediatamente a ChunkFileHeader
+struct ChunkEncodingHeader {
+    ChunkEncoding encoding = ChunkEncoding::RAW;    // Codificación elegida para este chunk
+    uint32_t encodedSize = 0;                       // Bytes del payload codificado
+    uint32_t generatorVersion = 0;                  // Solo en versión 3: versión del generador (0 = anterior a la versión 3)
+};
 #pragma pack(pop)
+
+// La versión 2 no incluye generatorVersion
+constexpr size_t CHUNK_ENCODING_HEADER_V2_SIZE = offsetof(ChunkEncodingHeader, generatorVersion);
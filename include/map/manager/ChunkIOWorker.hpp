@@ -0,0 +1,63 @@
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "map/manager/Chunk.hpp"
+#include "map/manager/ChunkCord.hpp"
+#include "map/manager/ChunkStorage.hpp"
+
+#include "data_structures/Linked_Queue.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+// Hilo de E/S con cola write-behind: los chunks descargados se entregan por
+// movimiento y se escriben a disco fuera del game loop.
+class ChunkIOWorker{
+private:
+    // ----- Atributos -----
+    ChunkStorage* _storage;                                     // No es dueño
+
+    std::thread _thread;
+    mutable std::mutex _mutex;
+    std::condition_variable _work_available;
+    std::condition_variable _work_done;
+
+    Unordered_map<ChunkCoord, std::unique_ptr<Chunk>> _pending;
+    Linked_Queue<ChunkCoord> _order;                            // Orden FIFO de escritura
+
+    bool _has_inflight = false;
+    ChunkCoord _inflight;
+    bool _stop = false;
+
+    size_t _written = 0;
+
+public:
+    // ----- Constructores -----
+    explicit ChunkIOWorker(ChunkStorage* storage);
+
+    ChunkIOWorker(const ChunkIOWorker& other) = delete;
+    ChunkIOWorker(ChunkIOWorker&& other) = delete;
+
+    // ----- Destructor -----
+    ~ChunkIOWorker();
+
+    // ----- Operadores -----
+    ChunkIOWorker& operator=(const ChunkIOWorker& other) = delete;
+    ChunkIOWorker& operator=(ChunkIOWorker&& other) = delete;
+
+    // ----- Métodos -----
+    void Enqueue(std::unique_ptr<Chunk>&& chunk);
+    std::unique_ptr<Chunk> TakePending(const ChunkCoord& coord);
+    bool IsPending(const ChunkCoord& coord) const;
+
+    // Barrera: bloquea hasta que toda escritura encolada antes de la llamada esté en disco
+    void Flush();
+
+    size_t GetPendingCount() const;
+    size_t GetWrittenCount() const;
+
+private:
+    void Run();
+};
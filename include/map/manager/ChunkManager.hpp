@@ -1,19 +1,74 @@
 #pragma once
 #include <string>
+#include <chrono>
+#include <span>
+#include <functional>
 
 #include "map/manager/ChunkCord.hpp"
 #include "map/manager/Chunk.hpp"
 #include "map/manager/Tile.hpp"
+#include "map/manager/TileRect.hpp"
+#include "map/manager/ChunkStorage.hpp"
+#include "map/manager/ChunkIOWorker.hpp"
+#include "map/manager/ChunkCache.hpp"
 
 #include "data_structures/Unordered_map.hpp"
 
+// Qué hacer con un chunk sin modificar al descargarlo
+enum class PersistPolicy{
+    ALWAYS,         // Guardar todo chunk que aún no tenga copia en disco
+    DIRTY_ONLY,     // Guardar solo los modificados; los limpios se regeneran desde la seed
+    ADAPTIVE        // Guardar los limpios solo si cargar es más barato que regenerar
+};
+
+// Aviso de carga (resident = true) o descarga de un chunk en el mapa de residentes
+using ResidencyListener = std::function<void(const ChunkCoord& coord, bool resident)>;
+
 class ChunkManager{
+public:
+    static constexpr size_t DEFAULT_CACHE_BUDGET = 64 * 1024 * 1024;    // Bytes para chunks descargados
+
 private:
     // ----- Atributos -----
     Unordered_map<ChunkCoord, std::unique_ptr<Chunk>> _chunks;
     uint32_t _chunk_size = 16;
     uint64_t _seed;
 
+    std::unique_ptr<ChunkStorage> _storage;
+    std::unique_ptr<ChunkIOWorker> _io_worker;      // Declarado después de _storage: se destruye antes
+    std::unique_ptr<ChunkCache> _cache;             // Chunks descargados recientemente
+
+    PersistPolicy _persist_policy = PersistPolicy::DIRTY_ONLY;
+    double _generation_cost = 0.0;      // Media móvil (s) de generar un chunk
+    double _load_cost = 0.0;            // Media móvil (s) de cargar un chunk de disco
+    size_t _skipped_writes = 0;         // Chunks descartados sin escribir a disco
+
+    // Último chunk consultado: accesos consecutivos al mismo chunk evitan el hash
+    Chunk* _last_chunk = nullptr;
+    ChunkCoord _last_coord;
+    uint64_t _unload_epoch = 0;         // Cambia con cada descarga: invalida punteros cacheados fuera
+
+    ResidencyListener _residency_listener;
+
+    // Presupuesto de memoria de los chunks residentes
+    struct EvictionCandidate {
+        float score;                    // Mayor = menor prioridad
+        ChunkCoord coord;
+    };
+
+    size_t _memory_budget = 0;          // 0 = sin límite
+    size_t _resident_bytes = 0;
+    uint64_t _frame = 0;
+
+    DynamicArray<EvictionCandidate> _eviction_queue;    // Ordenada de menor a mayor prioridad
+    size_t _eviction_cursor = 0;
+    uint64_t _eviction_queue_frame = 0;
+
+    size_t _budget_evictions = 0;
+    size_t _window_evictions = 0;
+    double _evictions_per_second = 0.0;
+    std::chrono::steady_clock::time_point _window_start = std::chrono::steady_clock::now();
+
 public:
     // ----- Constructores -----
     explicit ChunkManager(uint32_t chunk_size = 16,  
@@ -23,7 +78,7 @@ public:
     ChunkManager(ChunkManager&& other) noexcept;
 
     // ----- Destructor -----
-    ~ChunkManager() = default;
+    ~ChunkManager();
 
     // ----- Operadores -----
     ChunkManager& operator=(const ChunkManager& other) = delete;        // Operador de asignación por copia
@@ -68,6 +123,16 @@ public:
 
     const uint32_t& getChunkSize() const { return _chunk_size; }
 
+    // Regiones rectangulares: se copian por tramos de fila dentro de cada chunk.
+    // out/in van fila a fila (rect.width tiles por fila). Los chunks ausentes
+    // (ni residentes, ni en caché, ni en disco) se omiten; devuelven los tiles copiados.
+    size_t ReadRegion(const TileRect& rect, std::span<Tile> out);
+    size_t ReadRegion(const TileRect& rect, std::span<Tile> out) const;
+    size_t WriteRegion(const TileRect& rect, std::span<const Tile> in);
+
+    void GetRegionChunks(const TileRect& rect, DynamicArray<ChunkCoord>& out) const;
+    void PrefetchRegion(const TileRect& rect);
+
     // Eliminacion/descarga
     void eraseChunk(const ChunkCoord& coord);
   
@@ -76,6 +141,55 @@ public:
     bool HasChunk(int worldX, int worldY) const;
 
     size_t GetLoadedChunkCount() const { return _chunks.size(); }    
+    uint64_t GetUnloadEpoch() const { return _unload_epoch; }
+
+    // Solo chunks residentes: no consulta caché ni disco
+    Chunk* FindChunk(const ChunkCoord& coord);
+
+    void SetResidencyListener(ResidencyListener listener) { _residency_listener = std::move(listener); }
+
+    // Almacenamiento
+    void SetStorageFormat(StorageFormat format);
+    StorageFormat GetStorageFormat() const;
+
+    void SetMappedReads(bool enabled);
+    void SetCompression(bool enabled);
+
+    void SetBaselineProvider(BaselineProvider provider);
+    void SetDeltaThreshold(float threshold);
+    void SetGeneratorVersion(uint32_t version);
+
+    void SetChunkDirectory(const std::string& directory);
+    std::string GetChunkDirectory() const;
+
+    void FlushStorage();     // Barrera: espera las escrituras pendientes y vacía los buffers
+    size_t GetPendingWriteCount() const;
+
+    // Persistencia de chunks sin modificar
+    void SetPersistPolicy(PersistPolicy policy) { _persist_policy = policy; }
+    PersistPolicy GetPersistPolicy() const { return _persist_policy; }
+
+    void RecordGenerationTime(double seconds);
+    double GetGenerationCost() const { return _generation_cost; }
+    double GetLoadCost() const { return _load_cost; }
+    size_t GetSkippedWriteCount() const { return _skipped_writes; }
+
+    // Presupuesto de memoria: expulsa chunks residentes de menor prioridad hasta
+    // volver bajo el presupuesto o agotar timeBudgetSeconds. Llamar una vez por frame.
+    // Si evictedOut no es nulo, se añaden las coordenadas expulsadas.
+    size_t EnforceMemoryBudget(const DynamicArray<ChunkCoord>& centers, double timeBudgetSeconds,
+                               DynamicArray<ChunkCoord>* evictedOut = nullptr);
+
+    void SetMemoryBudget(size_t budgetBytes) { _memory_budget = budgetBytes; }
+    size_t GetMemoryBudget() const { return _memory_budget; }
+    size_t GetResidentBytes() const { return _resident_bytes; }
+    size_t GetBudgetEvictionCount() const { return _budget_evictions; }
+    double GetEvictionsPerSecond() const { return _evictions_per_second; }
+
+    // Cache de chunks descargados
+    void SetChunkCacheBudget(size_t budgetBytes);
+    void SetChunkCacheCompressed(bool compressed);
+    const ChunkCache& GetChunkCache() const { return *_cache; }
 
 // Iteradores
 
@@ -164,6 +278,22 @@ private:
     // Disk - Chunks
     std::unique_ptr<Chunk> LoadChunkFromDisk(const ChunkCoord& coord);
     void SaveChunkToDisk(Chunk* chunk);
+    void PrefetchNeighbors(const ChunkCoord& coord);
+
+    // Recorre los tramos de fila de rect: visit(chunk, localX, localY, length, offset)
+    template <typename Resolve, typename Visit>
+    size_t ForEachRegionSpan(const TileRect& rect, Resolve&& resolve, Visit&& visit) const;
+    bool ShouldPersist(const Chunk& chunk) const;
+    void RetireChunk(std::unique_ptr<Chunk>&& chunk);
+    void RetireChunks(DynamicArray<std::unique_ptr<Chunk>>& chunks);
+    void ClearChunkCache();
+
+    // Presupuesto de memoria
+    void BuildEvictionQueue(const DynamicArray<ChunkCoord>& centers);
+    float EvictionScore(const Chunk& chunk, const DynamicArray<ChunkCoord>& centers) const;
+    void UpdateEvictionRate(size_t evicted);
+
+    static void UpdateAverage(double& average, double sample);
 
     // Dynamic Link - Chunks
     void LinkChunkNeighbors(Chunk* chunk);
@@ -171,6 +301,6 @@ private:
     
     // PATH - Chunks
     std::string GetExecutableDirectory() const;
-    std::string GetChunkDirectory() const;
+    std::string GetDefaultChunkDirectory() const;
 
 };
\ No newline at end of file
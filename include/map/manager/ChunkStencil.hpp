@@ -0,0 +1,101 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <functional>
+
+#include "map/manager/Chunk.hpp"
+#include "map/manager/Tile.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+
+class ChunkManager;
+
+// Copia contigua de un chunk más un halo de `halo` tiles tomado de sus ocho
+// vecinos. Las coordenadas locales van de -halo a chunkSize + halo - 1, así que
+// un kernel 3x3 (halo 1) o 5x5 (halo 2) recorre el interior sin comprobar bordes.
+// Si falta un vecino, su parte del halo replica el borde del chunk central.
+class ChunkStencil{
+private:
+    // ----- Atributos -----
+    DynamicArray<Tile> _tiles;
+    int _chunk_size = 0;
+    int _halo = 0;
+    int _stride = 0;                // chunkSize + 2 * halo
+    int _missing_neighbors = 0;
+
+public:
+    // ----- Constructores -----
+    ChunkStencil() = default;
+
+    ChunkStencil(const ChunkStencil& other) = delete;
+    ChunkStencil(ChunkStencil&& other) noexcept = default;
+
+    // ----- Destructor -----
+    ~ChunkStencil() = default;
+
+    // ----- Operadores -----
+    ChunkStencil& operator=(const ChunkStencil& other) = delete;
+    ChunkStencil& operator=(ChunkStencil&& other) noexcept = default;
+
+    // ----- Métodos -----
+    void Build(const Chunk& center, uint32_t halo);
+
+    // Fila y en coordenadas locales; row(y)[x] es válido para x en [-halo, chunkSize + halo)
+    const Tile* row(int y) const { return _tiles.data() + (y + _halo) * _stride + _halo; }
+    const Tile& at(int x, int y) const { return row(y)[x]; }
+
+    int GetChunkSize() const { return _chunk_size; }
+    int GetHalo() const { return _halo; }
+    int GetStride() const { return _stride; }
+    int GetMissingNeighbors() const { return _missing_neighbors; }
+    bool IsComplete() const { return _missing_neighbors == 0; }
+
+private:
+    Tile* mutableRow(int y) { return _tiles.data() + (y + _halo) * _stride + _halo; }
+
+    void CopyBlock(const Chunk& source, int srcX, int srcY, int dstX, int dstY, int width, int height);
+    void ClampBlock(int dstX, int dstY, int width, int height);
+
+    static const Chunk* Neighbor(const Chunk& center, int dx, int dy);
+};
+
+// Kernel de actualización: lee el chunk con halo y escribe chunkSize x chunkSize
+// tiles, fila a fila, en target
+using StencilKernel = std::function<void(const ChunkStencil& source, std::span<Tile> target)>;
+
+// Actualización con doble buffer sobre todos los chunks ACTIVE: cada kernel lee
+// el estado anterior completo (vecinos incluidos) y los resultados se aplican al
+// final, escribiendo solo las filas que cambiaron.
+class StencilDriver{
+private:
+    // ----- Atributos -----
+    ChunkStencil _stencil;
+    DynamicArray<Chunk*> _targets;
+    DynamicArray<Tile> _back;       // Buffer de escritura: chunks activos x chunkSize^2
+
+    size_t _changed_tiles = 0;
+
+public:
+    // ----- Constructores -----
+    StencilDriver() = default;
+
+    StencilDriver(const StencilDriver& other) = delete;
+    StencilDriver(StencilDriver&& other) noexcept = default;
+
+    // ----- Destructor -----
+    ~StencilDriver() = default;
+
+    // ----- Operadores -----
+    StencilDriver& operator=(const StencilDriver& other) = delete;
+    StencilDriver& operator=(StencilDriver&& other) noexcept = default;
+
+    // ----- Métodos -----
+    // Devuelve los chunks actualizados
+    size_t Run(ChunkManager& manager, uint32_t halo, const StencilKernel& kernel);
+
+    size_t GetChangedTileCount() const { return _changed_tiles; }
+
+private:
+    size_t Commit(Chunk& chunk, const Tile* result);
+};
@@ -0,0 +1,129 @@
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <mutex>
+#include <functional>
+
+#include "map/manager/Chunk.hpp"
+#include "map/manager/ChunkCord.hpp"
+#include "map/manager/RegionFile.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+enum class StorageFormat{
+    PER_FILE,       // Un archivo chunk_X_Y.chnk por chunk (formato original)
+    REGION          // REGION_SIZE x REGION_SIZE chunks por archivo region_X_Y.rgn
+};
+
+// Regenera el contenido original (sin ediciones) de un chunk; debe ser determinista y reentrante
+using BaselineProvider = std::function<std::unique_ptr<Chunk>(const ChunkCoord& coord, uint32_t chunkSize)>;
+
+class ChunkStorage{
+private:
+    // ----- Atributos -----
+    std::string _directory;
+    uint32_t _chunk_size = 16;
+    uint64_t _seed;
+
+    StorageFormat _format = StorageFormat::REGION;
+    RegionFileCache _regions;
+    bool _mapped_reads = true;      // mmap en lugar de ifstream para cargar
+    bool _compression = true;       // Escribe la versión 2 (comprimida) del formato
+
+    // Índice en memoria de los chunks guardados y su formato: los fallos no tocan el disco
+    Unordered_map<ChunkCoord, StorageFormat> _index;
+    bool _index_built = false;
+
+    BaselineProvider _baseline;         // Línea base para la codificación DELTA (vacío = desactivada)
+    float _delta_threshold = 0.25f;     // Fracción máxima de tiles editados para usar DELTA
+
+    // Versión del generador que se escribe en cada chunk. Los chunks de otra versión que no
+    // se pueden cargar (diferencias frente a otra línea base) no se sobrescriben
+    uint32_t _generator_version = 0;
+    Unordered_map<ChunkCoord, uint32_t> _incompatible;     // Chunk -> versión con la que se guardó
+    bool _generator_warned = false;
+
+    std::mutex _mutex;      // Serializa el acceso a disco (hilo principal + hilo de E/S)
+
+public:
+    // ----- Constructores -----
+    explicit ChunkStorage(const std::string& directory,
+                          uint32_t chunk_size = 16,
+                          uint64_t worldSeed = 12345,
+                          StorageFormat format = StorageFormat::REGION);
+
+    ChunkStorage(const ChunkStorage& other) = delete;
+    ChunkStorage(ChunkStorage&& other) = delete;
+
+    // ----- Destructor -----
+    ~ChunkStorage();
+
+    // ----- Operadores -----
+    ChunkStorage& operator=(const ChunkStorage& other) = delete;
+    ChunkStorage& operator=(ChunkStorage&& other) = delete;
+
+    // ----- Métodos -----
+    // Disco
+    std::unique_ptr<Chunk> Load(const ChunkCoord& coord);
+    bool Save(const Chunk& chunk);
+    bool Erase(const ChunkCoord& coord);
+    void Flush();
+
+    // Índice de presencia
+    bool Contains(const ChunkCoord& coord);
+    size_t GetStoredCount();
+    void RebuildIndex();
+
+    // Pista de lectura anticipada para un chunk que probablemente se cargue pronto
+    void Prefetch(const ChunkCoord& coord);
+
+    // Serializacion
+    void SerializeChunk(const Chunk& chunk, DynamicArray<char>& out) const;
+    // generatorVersion recibe la versión guardada en el chunk: 0 en la versión 2, sin cambios en la 1
+    std::unique_ptr<Chunk> DeserializeChunk(const char* data, size_t size, const ChunkCoord& coord,
+                                            uint32_t* generatorVersion = nullptr) const;
+
+    // Configuracion
+    void SetFormat(StorageFormat format);
+    StorageFormat GetFormat() const { return _format; }
+
+    void SetMappedReads(bool enabled) { _mapped_reads = enabled; }
+    bool GetMappedReads() const { return _mapped_reads; }
+
+    void SetCompression(bool enabled) { _compression = enabled; }
+    bool GetCompression() const { return _compression; }
+
+    void SetBaselineProvider(BaselineProvider provider) { _baseline = std::move(provider); }
+    bool HasBaselineProvider() const { return static_cast<bool>(_baseline); }
+
+    void SetDeltaThreshold(float threshold) { _delta_threshold = threshold; }
+    float GetDeltaThreshold() const { return _delta_threshold; }
+
+    void SetGeneratorVersion(uint32_t version);
+    uint32_t GetGeneratorVersion() const { return _generator_version; }
+    size_t GetIncompatibleCount();      // Chunks rechazados por la versión del generador
+
+    void SetDirectory(const std::string& directory);
+    const std::string& GetDirectory() const { return _directory; }
+
+    const RegionFileCache& GetRegionCache() const { return _regions; }
+
+private:
+    // Formato por archivo
+    std::unique_ptr<Chunk> LoadFromFile(const ChunkCoord& coord, uint32_t& generatorVersion);
+    bool SaveToFile(const Chunk& chunk, const DynamicArray<char>& payload);
+
+    // Formato por región
+    std::unique_ptr<Chunk> LoadFromRegion(const ChunkCoord& coord, uint32_t& generatorVersion);
+    bool SaveToRegion(const Chunk& chunk, const DynamicArray<char>& payload);
+
+    std::string GetChunkFilePath(const ChunkCoord& coord) const;
+
+    // Índice de presencia (requieren _mutex)
+    void EnsureIndex();
+    void ScanDirectory();
+    static bool ParseCoordName(const std::string& name, const std::string& prefix,
+                               const std::string& extension, ChunkCoord& coord);
+};
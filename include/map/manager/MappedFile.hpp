@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+// Vista de solo lectura de un archivo mapeado en memoria
+class MappedFile{
+private:
+    // ----- Atributos -----
+    const char* _data = nullptr;
+    size_t _size = 0;
+
+#ifdef _WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#else
+    int _fd = -1;
+#endif
+
+public:
+    // ----- Constructores -----
+    MappedFile() = default;
+
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+
+    // ----- Destructor -----
+    ~MappedFile();
+
+    // ----- Operadores -----
+    MappedFile& operator=(const MappedFile& other) = delete;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // ----- Métodos -----
+    bool Open(const std::string& path);
+    void Close();
+
+    // Pista de lectura anticipada para el rango [offset, offset + length)
+    void WillNeed(size_t offset, size_t length) const;
+
+    bool IsOpen() const { return _data != nullptr; }
+    const char* data() const { return _data; }
+    size_t size() const { return _size; }
+
+private:
+    void Reset();
+};
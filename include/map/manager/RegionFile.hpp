@@ -0,0 +1,136 @@
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <fstream>
+
+#include "map/manager/ChunkCord.hpp"
+#include "map/manager/MappedFile.hpp"
+
+#include "data_structures/DynamicArray.hpp"
+#include "data_structures/Double_Linked_List.hpp"
+#include "data_structures/Unordered_map.hpp"
+
+// Una region agrupa REGION_SIZE x REGION_SIZE chunks en un unico archivo:
+//  [RegionFileHeader][RegionEntry x REGION_CHUNKS] ... payloads alineados a sectores
+#pragma pack(push, 1)
+struct RegionFileHeader {
+    char magic[4] = {'R', 'G', 'N', 'F'};   // Identificador mágico
+    uint32_t version = 1;                   // Versión del formato de región
+    uint32_t sectorSize = 4096;             // Tamaño de sector en bytes
+    uint32_t regionSize = 32;               // Chunks por lado de la región
+};
+
+struct RegionEntry {
+    uint32_t sectorOffset = 0;              // Primer sector del payload (0 = vacío)
+    uint32_t byteLength = 0;                // Longitud real del payload en bytes
+};
+#pragma pack(pop)
+
+class RegionFile{
+public:
+    static constexpr int REGION_SIZE = 32;
+    static constexpr uint32_t REGION_CHUNKS = REGION_SIZE * REGION_SIZE;
+    static constexpr uint32_t SECTOR_SIZE = 4096;
+    static constexpr uint32_t HEADER_BYTES = sizeof(RegionFileHeader) + REGION_CHUNKS * sizeof(RegionEntry);
+    static constexpr uint32_t HEADER_SECTORS = (HEADER_BYTES + SECTOR_SIZE - 1) / SECTOR_SIZE;
+
+private:
+    // ----- Atributos -----
+    std::string _path;
+    std::fstream _file;
+    ChunkCoord _regionCoord;
+
+    DynamicArray<RegionEntry> _entries;
+    DynamicArray<uint8_t> _usedSectors;     // 1 = sector ocupado
+
+    MappedFile _view;                       // Vista mmap para lecturas sin copia intermedia
+    bool _unflushed = false;                // Escrituras en el buffer de _file aún no visibles en _view
+
+public:
+    // ----- Constructores -----
+    RegionFile(const std::string& path, ChunkCoord regionCoord);
+
+    RegionFile(const RegionFile& other) = delete;
+    RegionFile(RegionFile&& other) = delete;
+
+    // ----- Destructor -----
+    ~RegionFile();
+
+    // ----- Operadores -----
+    RegionFile& operator=(const RegionFile& other) = delete;
+    RegionFile& operator=(RegionFile&& other) = delete;
+
+    // ----- Métodos -----
+    bool Open(bool create);
+    bool IsOpen() const { return _file.is_open(); }
+    void Flush();
+
+    bool HasChunk(const ChunkCoord& chunkCoord) const;
+    bool ReadChunk(const ChunkCoord& chunkCoord, DynamicArray<char>& out);
+    bool MapChunk(const ChunkCoord& chunkCoord, const char*& data, uint32_t& length);
+    void Prefetch(const ChunkCoord& chunkCoord);
+    bool WriteChunk(const ChunkCoord& chunkCoord, const char* data, uint32_t length);
+    bool EraseChunk(const ChunkCoord& chunkCoord);
+
+    uint32_t GetSectorCount() const { return static_cast<uint32_t>(_usedSectors.size()); }
+    const ChunkCoord& GetRegionCoord() const { return _regionCoord; }
+    const std::string& GetPath() const { return _path; }
+
+    // Lee solo la tabla de offsets de un archivo de región y devuelve los chunks guardados
+    static bool ListChunks(const std::string& path, const ChunkCoord& regionCoord, DynamicArray<ChunkCoord>& out);
+
+    // Conversiones
+    static ChunkCoord ChunkToRegion(const ChunkCoord& chunkCoord);
+    static uint32_t LocalIndex(const ChunkCoord& chunkCoord);
+
+private:
+    // ----- Gestion de sectores -----
+    static uint32_t SectorsFor(uint32_t length) { return (length + SECTOR_SIZE - 1) / SECTOR_SIZE; }
+
+    uint32_t AllocateSectors(uint32_t count);
+    void MarkSectors(uint32_t first, uint32_t count, uint8_t used);
+    bool WriteEntry(uint32_t index);
+};
+
+// Cache LRU de archivos de región abiertos, reutilizados entre cargas y guardados
+class RegionFileCache{
+private:
+    // ----- Atributos -----
+    Unordered_map<ChunkCoord, std::unique_ptr<RegionFile>> _open;
+    Double_Linked_List<ChunkCoord> _recency;    // Frente = menos usado
+    std::string _directory;
+    size_t _capacity = 16;
+
+public:
+    // ----- Constructores -----
+    explicit RegionFileCache(const std::string& directory = ".", size_t capacity = 16);
+
+    RegionFileCache(const RegionFileCache& other) = delete;
+    RegionFileCache(RegionFileCache&& other) = delete;
+
+    // ----- Destructor -----
+    ~RegionFileCache() = default;
+
+    // ----- Operadores -----
+    RegionFileCache& operator=(const RegionFileCache& other) = delete;
+    RegionFileCache& operator=(RegionFileCache&& other) = delete;
+
+    // ----- Métodos -----
+    RegionFile* Get(const ChunkCoord& regionCoord, bool create);
+
+    void FlushAll();
+    void CloseAll();
+
+    void SetDirectory(const std::string& directory);
+    const std::string& GetDirectory() const { return _directory; }
+
+    size_t GetOpenCount() const { return _open.size(); }
+    size_t GetCapacity() const { return _capacity; }
+
+    std::string GetRegionPath(const ChunkCoord& regionCoord) const;
+
+private:
+    void Touch(const ChunkCoord& regionCoord);
+    void EvictLeastRecent();
+};
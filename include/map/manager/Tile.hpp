@@ -48,6 +48,9 @@ public:
         return *this;
     }
 
+    bool operator==(const Tile& other) const { return _biomeId == other._biomeId && _hasWater == other._hasWater; }
+    bool operator!=(const Tile& other) const { return !(*this == other); }
+
     // ----- Métodos -----
 
     int getBiomeId() const { return _biomeId; }
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// Rectángulo de tiles en coordenadas de mundo: [x, x + width) x [y, y + height)
+struct TileRect {
+    int x = 0;
+    int y = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+
+    size_t area() const { return static_cast<size_t>(width) * height; }
+    bool empty() const { return width == 0 || height == 0; }
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+
+// Generador basado en contador (SplitMix64): el valor n de un stream es mix(key + n * GAMMA),
+// una función pura de (key, n). Crearlo son un par de multiplicaciones en lugar de los 312
+// words de estado de mt19937_64, no comparte estado y cada hilo puede abrir el stream que
+// quiera. Cumple UniformRandomBitGenerator, pero los helpers nextFloat/nextBelow consumen
+// siempre un valor y no dependen de la implementación de <random>: mismos resultados con
+// cualquier compilador.
+class CounterRng {
+private:
+    static constexpr uint64_t GAMMA = 0x9E3779B97F4A7C15ull;
+
+    // ----- Atributos -----
+    uint64_t _key;
+    uint64_t _counter = 0;
+
+public:
+    using result_type = uint64_t;
+
+    // ----- Constructores -----
+    explicit CounterRng(uint64_t key) : _key(key) {}
+
+    // Stream independiente por (worldSeed, celda, stream)
+    CounterRng(uint64_t worldSeed, int cellX, int cellY, uint64_t stream = 0)
+        : _key(cellKey(worldSeed, cellX, cellY, stream)) {}
+
+    // ----- Métodos -----
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() { return at(_counter++); }
+
+    // Valor n del stream sin avanzar
+    result_type at(uint64_t n) const { return mix(_key + (n + 1) * GAMMA); }
+
+    void seek(uint64_t n) { _counter = n; }
+    uint64_t position() const { return _counter; }
+
+    // [0, 1) con los 24 bits altos: todos los floats equiespaciados del intervalo
+    float nextFloat() { return static_cast<float>((*this)() >> 40) * (1.0f / 16777216.0f); }
+    float nextFloat(float low, float high) { return low + (high - low) * nextFloat(); }
+
+    // [0, bound) por multiplicación (Lemire) sin rechazo: sesgo < bound / 2^32
+    uint32_t nextBelow(uint32_t bound) {
+        return static_cast<uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+    // Finalizador de SplitMix64: biyectivo y con avalancha completa
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Para una semilla y stream fijos la clave es biyectiva en la celda: no hay colisiones
+    static uint64_t cellKey(uint64_t worldSeed, int cellX, int cellY, uint64_t stream = 0) {
+        uint64_t cell = (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+                        static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+        return mix(mix(worldSeed + stream * GAMMA) ^ cell);
+    }
+};
@@ -0,0 +1,206 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <algorithm>
+
+#include "utils/PerlinNoise.hpp"
+#include "data_structures/DynamicArray.hpp"
+
+enum class FractalType : uint8_t {
+    FBM,        // Suma de octavas, valores en ~[-1, 1]
+    RIDGED      // Crestas (1 - |n|)^2 con realimentación entre octavas, valores en [0, 1]
+};
+
+struct FractalConfig {
+    FractalType type = FractalType::FBM;
+    float frequency = 0.01f;        // Ciclos por tile de la primera octava
+    int octaves = 4;
+    float lacunarity = 2.0f;        // Factor de frecuencia entre octavas
+    float gain = 0.5f;              // Factor de amplitud entre octavas
+
+    // Desplaza el dominio: separa usos distintos de la misma permutación
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    // Domain warping: cada tile se desplaza por dos fBm antes de muestrear (0 = sin warp)
+    float warpStrength = 0.0f;      // Desplazamiento máximo en tiles
+    float warpFrequency = 0.005f;
+    int warpOctaves = 2;
+
+    FractalConfig() = default;
+    FractalConfig(FractalType fractalType, float freq, int octaveCount, float lac = 2.0f, float gn = 0.5f)
+        : type(fractalType), frequency(freq), octaves(octaveCount), lacunarity(lac), gain(gn) {}
+};
+
+// Ruido fractal sobre una rejilla de tiles en una pasada. Cada octava se evalúa fila a
+// fila con PerlinNoise::noise2D (SIMD, hashes reutilizados por celda de la rejilla) y
+// se acumula sobre la rejilla completa, así las x de cada octava se calculan una sola
+// vez. Sin estado mutable: se puede usar a la vez desde varios hilos.
+class FractalNoise {
+private:
+    // ----- Atributos -----
+    const PerlinNoise* _noise;      // No es dueño
+    NoiseSimd _level;
+
+    // Desfase entre octavas: sin él todas pasan por 0 en el mismo punto de la rejilla
+    static constexpr float OCTAVE_OFFSET_X = 19.19f;
+    static constexpr float OCTAVE_OFFSET_Y = 7.31f;
+
+    // Los dos fBm del warp no pueden coincidir o el desplazamiento sería diagonal
+    static constexpr float WARP_OFFSET_X = 5.2f;
+    static constexpr float WARP_OFFSET_Y = 41.3f;
+
+    // Realimentación de ridged: una cresta débil atenúa las octavas siguientes
+    static constexpr float RIDGE_SHARPNESS = 2.0f;
+
+public:
+    // ----- Constructores -----
+    explicit FractalNoise(const PerlinNoise& noise, NoiseSimd level = PerlinNoise::simdLevel())
+        : _noise(&noise), _level(level) {}
+
+    // ----- Métodos -----
+    // out[y * width + x] = ruido del tile (originX + x, originY + y)
+    void generate(const FractalConfig& config, int originX, int originY,
+                  uint32_t width, uint32_t height, std::span<float> out) const {
+        size_t total = static_cast<size_t>(width) * height;
+        if (out.size() < total) {
+            throw std::invalid_argument("FractalNoise: out tiene menos de width * height valores");
+        }
+        if (config.octaves < 1 || (config.warpStrength != 0.0f && config.warpOctaves < 1)) {
+            throw std::invalid_argument("FractalNoise: se necesita al menos una octava");
+        }
+        if (total == 0) return;
+
+        std::span<float> grid = out.first(total);
+        if (config.warpStrength == 0.0f) {
+            gridOctaves(config, config.offsetX, config.offsetY, originX, originY, width, height, grid);
+            return;
+        }
+
+        // Desplazamiento en tiles; después se convierte en la posición deformada de cada tile
+        FractalConfig warp(FractalType::FBM, config.warpFrequency, config.warpOctaves,
+                           config.lacunarity, config.gain);
+        DynamicArray<float> warpedX(total, 0.0f);
+        DynamicArray<float> warpedY(total, 0.0f);
+        gridOctaves(warp, config.offsetX + WARP_OFFSET_X, config.offsetY, originX, originY, width, height,
+                    std::span<float>(warpedX.data(), total));
+        gridOctaves(warp, config.offsetX, config.offsetY + WARP_OFFSET_Y, originX, originY, width, height,
+                    std::span<float>(warpedY.data(), total));
+
+        for (uint32_t y = 0; y < height; ++y) {
+            float worldY = static_cast<float>(originY + static_cast<int>(y));
+            float* rowX = warpedX.data() + static_cast<size_t>(y) * width;
+            float* rowY = warpedY.data() + static_cast<size_t>(y) * width;
+            for (uint32_t x = 0; x < width; ++x) {
+                rowX[x] = static_cast<float>(originX + static_cast<int>(x)) + config.warpStrength * rowX[x];
+                rowY[x] = worldY + config.warpStrength * rowY[x];
+            }
+        }
+
+        pointOctaves(config, warpedX.data(), warpedY.data(), width, height, grid);
+    }
+
+    NoiseSimd getSimdLevel() const { return _level; }
+
+private:
+    // Rejilla regular: las x de la octava son las mismas en todas las filas
+    void gridOctaves(const FractalConfig& config, float offsetX, float offsetY, int originX, int originY,
+                     uint32_t width, uint32_t height, std::span<float> out) const {
+        std::fill(out.begin(), out.end(), 0.0f);
+
+        DynamicArray<float> xs(width, 0.0f);
+        DynamicArray<float> sample(width, 0.0f);
+        DynamicArray<float> weight(config.type == FractalType::RIDGED ? out.size() : 0, 1.0f);
+
+        float frequency = config.frequency;
+        float amplitude = 1.0f;
+        float amplitudeSum = 0.0f;
+
+        for (int octave = 0; octave < config.octaves; ++octave) {
+            float octaveX = offsetX + static_cast<float>(octave) * OCTAVE_OFFSET_X;
+            float octaveY = offsetY + static_cast<float>(octave) * OCTAVE_OFFSET_Y;
+            for (uint32_t x = 0; x < width; ++x) {
+                xs[x] = static_cast<float>(originX + static_cast<int>(x)) * frequency + octaveX;
+            }
+
+            for (uint32_t y = 0; y < height; ++y) {
+                float noiseY = static_cast<float>(originY + static_cast<int>(y)) * frequency + octaveY;
+                _noise->noise2D(std::span<const float>(xs.data(), width), noiseY,
+                                std::span<float>(sample.data(), width), _level);
+
+                size_t row = static_cast<size_t>(y) * width;
+                accumulateRow(config.type, sample.data(), amplitude, width, out.data() + row,
+                              weight.empty() ? nullptr : weight.data() + row);
+            }
+
+            amplitudeSum += amplitude;
+            amplitude *= config.gain;
+            frequency *= config.lacunarity;
+        }
+
+        normalize(out, amplitudeSum);
+    }
+
+    // Posiciones deformadas: cada tile tiene su propio (x, y) en tiles
+    void pointOctaves(const FractalConfig& config, const float* pointsX, const float* pointsY,
+                      uint32_t width, uint32_t height, std::span<float> out) const {
+        std::fill(out.begin(), out.end(), 0.0f);
+
+        DynamicArray<float> xs(width, 0.0f);
+        DynamicArray<float> ys(width, 0.0f);
+        DynamicArray<float> sample(width, 0.0f);
+        DynamicArray<float> weight(config.type == FractalType::RIDGED ? out.size() : 0, 1.0f);
+
+        float frequency = config.frequency;
+        float amplitude = 1.0f;
+        float amplitudeSum = 0.0f;
+
+        for (int octave = 0; octave < config.octaves; ++octave) {
+            float octaveX = config.offsetX + static_cast<float>(octave) * OCTAVE_OFFSET_X;
+            float octaveY = config.offsetY + static_cast<float>(octave) * OCTAVE_OFFSET_Y;
+
+            for (uint32_t y = 0; y < height; ++y) {
+                size_t row = static_cast<size_t>(y) * width;
+                for (uint32_t x = 0; x < width; ++x) {
+                    xs[x] = pointsX[row + x] * frequency + octaveX;
+                    ys[x] = pointsY[row + x] * frequency + octaveY;
+                }
+
+                _noise->noise2D(std::span<const float>(xs.data(), width), std::span<const float>(ys.data(), width),
+                                std::span<float>(sample.data(), width), _level);
+                accumulateRow(config.type, sample.data(), amplitude, width, out.data() + row,
+                              weight.empty() ? nullptr : weight.data() + row);
+            }
+
+            amplitudeSum += amplitude;
+            amplitude *= config.gain;
+            frequency *= config.lacunarity;
+        }
+
+        normalize(out, amplitudeSum);
+    }
+
+    // Bucles planos sin dependencias entre tiles: el compilador los vectoriza
+    static void accumulateRow(FractalType type, const float* sample, float amplitude, size_t count,
+                              float* out, float* weight) {
+        if (type == FractalType::FBM) {
+            for (size_t i = 0; i < count; ++i) out[i] += sample[i] * amplitude;
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            float signal = 1.0f - std::fabs(sample[i]);
+            signal = signal * signal * weight[i];
+            weight[i] = std::min(signal * RIDGE_SHARPNESS, 1.0f);
+            out[i] += signal * amplitude;
+        }
+    }
+
+    static void normalize(std::span<float> out, float amplitudeSum) {
+        float inverse = 1.0f / amplitudeSum;
+        for (float& value : out) value *= inverse;
+    }
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "data_structures/DynamicArray.hpp"
+
+// Compresor LZ77 de bytes (estilo LZ4): secuencias [token][literales][offset][extension]
+//  token = (longitud de literales << 4) | (longitud de match - MIN_MATCH), 15 = sigue extension
+class LZCompressor {
+private:
+    static constexpr size_t MIN_MATCH = 4;
+    static constexpr size_t MAX_OFFSET = 65535;
+    static constexpr int HASH_BITS = 12;
+
+    static uint32_t read32(const uint8_t* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static uint32_t hash(uint32_t v) {
+        return (v * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    static void writeLength(DynamicArray<char>& out, size_t length) {
+        while (length >= 255) {
+            out.push_back(static_cast<char>(255));
+            length -= 255;
+        }
+        out.push_back(static_cast<char>(length));
+    }
+
+    static bool readLength(const uint8_t*& ip, const uint8_t* end, size_t& length) {
+        uint8_t b;
+        do {
+            if (ip >= end) return false;
+            b = *ip++;
+            length += b;
+        } while (b == 255);
+        return true;
+    }
+
+    static void emitSequence(DynamicArray<char>& out, const uint8_t* literals, size_t literalLength,
+                             size_t offset, size_t matchLength, bool last) {
+        size_t matchCode = last ? 0 : matchLength - MIN_MATCH;
+        uint8_t token = static_cast<uint8_t>(((literalLength < 15 ? literalLength : 15) << 4) |
+                                             (matchCode < 15 ? matchCode : 15));
+        out.push_back(static_cast<char>(token));
+        if (literalLength >= 15) writeLength(out, literalLength - 15);
+
+        for (size_t i = 0; i < literalLength; ++i) out.push_back(static_cast<char>(literals[i]));
+        if (last) return;
+
+        out.push_back(static_cast<char>(offset & 0xFF));
+        out.push_back(static_cast<char>((offset >> 8) & 0xFF));
+        if (matchCode >= 15) writeLength(out, matchCode - 15);
+    }
+
+public:
+    // Comprime [data, data + size) y lo añade al final de out
+    static void compress(const uint8_t* data, size_t size, DynamicArray<char>& out) {
+        uint32_t table[1 << HASH_BITS];
+        for (uint32_t& entry : table) entry = UINT32_MAX;
+
+        size_t anchor = 0;
+        size_t ip = 0;
+
+        while (ip + MIN_MATCH <= size) {
+            uint32_t sequence = read32(data + ip);
+            uint32_t h = hash(sequence);
+            uint32_t candidate = table[h];
+            table[h] = static_cast<uint32_t>(ip);
+
+            if (candidate == UINT32_MAX || ip - candidate > MAX_OFFSET || read32(data + candidate) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            // Extender el match
+            size_t matchLength = MIN_MATCH;
+            while (ip + matchLength < size && data[candidate + matchLength] == data[ip + matchLength]) {
+                ++matchLength;
+            }
+
+            emitSequence(out, data + anchor, ip - anchor, ip - candidate, matchLength, false);
+            ip += matchLength;
+            anchor = ip;
+        }
+
+        // Literales finales (siempre se emite una última secuencia sin match)
+        emitSequence(out, data + anchor, size - anchor, 0, 0, true);
+    }
+
+    // Descomprime en out, que debe tener exactamente outSize bytes; false si los datos son inválidos
+    static bool decompress(const uint8_t* data, size_t size, uint8_t* out, size_t outSize) {
+        const uint8_t* ip = data;
+        const uint8_t* end = data + size;
+        size_t op = 0;
+
+        while (ip < end) {
+            uint8_t token = *ip++;
+
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !readLength(ip, end, literalLength)) return false;
+            if (literalLength > static_cast<size_t>(end - ip) || literalLength > outSize - op) return false;
+
+            std::memcpy(out + op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+
+            if (ip == end) return op == outSize;    // Última secuencia: solo literales
+
+            if (end - ip < 2) return false;
+            size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+
+            size_t matchLength = token & 0x0F;
+            if (matchLength == 15 && !readLength(ip, end, matchLength)) return false;
+            matchLength += MIN_MATCH;
+
+            if (offset == 0 || offset > op || matchLength > outSize - op) return false;
+
+            // Copia byte a byte: el match puede solaparse con la salida
+            const uint8_t* match = out + op - offset;
+            for (size_t i = 0; i < matchLength; ++i) out[op + i] = match[i];
+            op += matchLength;
+        }
+
+        // Falta la última secuencia: flujo truncado
+        return false;
+    }
+};
@@ -3,11 +3,44 @@
 #include <cstdint>
 #include <initializer_list>
 #include <stdexcept>
-#include <random>
 #include <algorithm>
 #include <cmath>
+#include <span>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PERLIN_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC fusiona mul + add en FMA si el objetivo lo tiene (avx512f lo implica) y entonces
+// cada ruta redondearía distinto; Clang y MSVC no fusionan entre intrínsecos
+#if defined(__GNUC__) && !defined(__clang__)
+#define PERLIN_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define PERLIN_NO_CONTRACT
+#endif
+
+// GCC/Clang necesitan habilitar el conjunto de instrucciones por función; MSVC no
+#if defined(PERLIN_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PERLIN_TARGET(isa) __attribute__((target(isa))) PERLIN_NO_CONTRACT
+#else
+#define PERLIN_TARGET(isa)
+#endif
 
 #include "data_structures/DynamicArray.hpp"
+#include "utils/CounterRng.hpp"
+
+// Nivel SIMD usado por PerlinNoise::noise2D
+enum class NoiseSimd : uint8_t {
+    SCALAR,
+    SSE41,
+    AVX2,
+    AVX512
+};
 
 class PerlinNoise {
 private:
@@ -50,9 +83,9 @@ public:
         }
         
         // Barajar usando la semilla
-        std::mt19937_64 rng(seed);
+        CounterRng rng(seed);
         for (int i = 255; i > 0; --i) {
-            int j = rng() % (i + 1);
+            int j = static_cast<int>(rng.nextBelow(static_cast<uint32_t>(i + 1)));
             int temp = p[i];
             p[i] = p[j];
             p[j] = temp;
@@ -76,9 +109,9 @@ public:
         }
         
         // Barajar usando la semilla
-        std::mt19937_64 rng(12345);
+        CounterRng rng(12345);
         for (int i = 255; i > 0; --i) {
-            int j = rng() % (i + 1);
+            int j = static_cast<int>(rng.nextBelow(static_cast<uint32_t>(i + 1)));
             int temp = p[i];
             p[i] = p[j];
             p[j] = temp;
@@ -165,4 +198,377 @@ public:
         
         return mainRiver + meanders + edges;
     }
+
+    // ----- Ruido 2D por lotes -----
+    // Equivale a noise(x, y, 0.0) en float para cada x de xs con la misma y: con z = 0
+    // solo interviene la capa inferior de la celda. Los hashes de la tabla se calculan
+    // una vez por celda de la rejilla y los gradientes se eligen con máscaras, sin
+    // tablas. Todas las rutas hacen las mismas operaciones float en el mismo orden.
+    void noise2D(std::span<const float> xs, float y, std::span<float> out) const {
+        noise2D(xs, y, out, simdLevel());
+    }
+
+    void noise2D(std::span<const float> xs, float y, std::span<float> out, NoiseSimd level) const {
+        size_t n = xs.size() < out.size() ? xs.size() : out.size();
+
+        const float ys[1] = { y };
+
+        for (size_t start = 0; start < n; start += BLOCK) {
+            size_t count = (n - start) < BLOCK ? (n - start) : BLOCK;
+            evaluateBlock<true>(xs.data() + start, ys, count, level, out.data() + start);
+        }
+    }
+
+    // Puntos sueltos (xs[i], ys[i]), p. ej. una rejilla deformada por domain warping.
+    // Los hashes se reutilizan mientras puntos consecutivos caen en la misma celda
+    void noise2D(std::span<const float> xs, std::span<const float> ys, std::span<float> out) const {
+        noise2D(xs, ys, out, simdLevel());
+    }
+
+    void noise2D(std::span<const float> xs, std::span<const float> ys, std::span<float> out,
+                 NoiseSimd level) const {
+        size_t n = xs.size() < ys.size() ? xs.size() : ys.size();
+        if (out.size() < n) n = out.size();
+
+        for (size_t start = 0; start < n; start += BLOCK) {
+            size_t count = (n - start) < BLOCK ? (n - start) : BLOCK;
+            evaluateBlock<false>(xs.data() + start, ys.data() + start, count, level, out.data() + start);
+        }
+    }
+
+    // Mejor nivel disponible en la CPU, detectado una sola vez
+    static NoiseSimd simdLevel() {
+        static const NoiseSimd level = detectSimd();
+        return level;
+    }
+
+    static NoiseSimd detectSimd() {
+#ifdef PERLIN_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+
+        __cpuid(info, 1);
+        bool sse41 = (info[2] & (1 << 19)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+
+        // El SO debe guardar los registros YMM/ZMM en los cambios de contexto
+        unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        bool ymmState = (xcr0 & 0x6) == 0x6;
+        bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+        bool avx2 = false, avx512 = false;
+        if (maxLeaf >= 7) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+            avx512 = (info[1] & (1 << 16)) != 0;
+        }
+
+        if (avx512 && zmmState) return NoiseSimd::AVX512;
+        if (avx2 && avx && ymmState) return NoiseSimd::AVX2;
+        if (sse41) return NoiseSimd::SSE41;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return NoiseSimd::AVX512;
+        if (__builtin_cpu_supports("avx2")) return NoiseSimd::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return NoiseSimd::SSE41;
+#endif
+#endif
+        return NoiseSimd::SCALAR;
+    }
+
+private:
+    static constexpr size_t BLOCK = 64;
+
+    PERLIN_NO_CONTRACT static float fade2D(float t) { return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f); }
+    PERLIN_NO_CONTRACT static float lerp2D(float t, float a, float b) { return a + t * (b - a); }
+
+    PERLIN_NO_CONTRACT
+    static float grad2D(int32_t hash, float x, float y) {
+        int32_t h = hash & 15;
+        float u = h < 8 ? x : y;
+        float v = h < 4 ? y : (h == 12 || h == 14 ? x : 0.0f);
+        return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+    }
+
+    // SHARED_Y: todas las lanes comparten ys[0] (una fila) y su parte de y se calcula una vez
+    template <bool SHARED_Y>
+    void evaluateBlock(const float* xs, const float* ys, size_t count, NoiseSimd level, float* out) const {
+        alignas(64) int32_t h00[BLOCK], h10[BLOCK], h01[BLOCK], h11[BLOCK];
+        hashBlock<SHARED_Y>(xs, ys, count, h00, h10, h01, h11);
+
+        switch (level) {
+#ifdef PERLIN_X86
+            case NoiseSimd::AVX512: blockAVX512<SHARED_Y>(xs, ys, count, h00, h10, h01, h11, out); break;
+            case NoiseSimd::AVX2:   blockAVX2<SHARED_Y>(xs, ys, count, h00, h10, h01, h11, out); break;
+            case NoiseSimd::SSE41:  blockSSE41<SHARED_Y>(xs, ys, count, h00, h10, h01, h11, out); break;
+#endif
+            default:                blockScalar<SHARED_Y>(xs, ys, count, h00, h10, h01, h11, out); break;
+        }
+    }
+
+    // Hashes de las cuatro esquinas; los puntos avanzan despacio, así que se reutilizan por celda
+    template <bool SHARED_Y>
+    void hashBlock(const float* xs, const float* ys, size_t count,
+                   int32_t* h00, int32_t* h10, int32_t* h01, int32_t* h11) const {
+        int rowY = static_cast<int>(std::floor(ys[0]));
+        int lastX = 0, lastY = rowY;
+        bool hasLast = false;
+        int32_t c00 = 0, c10 = 0, c01 = 0, c11 = 0;
+
+        for (size_t i = 0; i < count; ++i) {
+            int xi = static_cast<int>(std::floor(xs[i]));
+            int yi = SHARED_Y ? rowY : static_cast<int>(std::floor(ys[i]));
+            if (!hasLast || xi != lastX || yi != lastY) {
+                int X = xi & 255;
+                int Y = yi & 255;
+                int A = p[X] + Y;
+                int B = p[X + 1] + Y;
+                c00 = p[p[A]];
+                c01 = p[p[A + 1]];
+                c10 = p[p[B]];
+                c11 = p[p[B + 1]];
+                lastX = xi;
+                lastY = yi;
+                hasLast = true;
+            }
+            h00[i] = c00;
+            h10[i] = c10;
+            h01[i] = c01;
+            h11[i] = c11;
+        }
+    }
+
+    template <bool SHARED_Y>
+    PERLIN_NO_CONTRACT
+    static void blockScalar(const float* xs, const float* ys, size_t count,
+                            const int32_t* h00, const int32_t* h10, const int32_t* h01, const int32_t* h11,
+                            float* out) {
+        float y0 = ys[0] - std::floor(ys[0]);
+        float y1 = y0 - 1.0f;
+        float v = fade2D(y0);
+
+        for (size_t i = 0; i < count; ++i) {
+            float x0 = xs[i] - std::floor(xs[i]);
+            float x1 = x0 - 1.0f;
+            float u = fade2D(x0);
+            if constexpr (!SHARED_Y) {
+                y0 = ys[i] - std::floor(ys[i]);
+                y1 = y0 - 1.0f;
+                v = fade2D(y0);
+            }
+
+            float a = lerp2D(u, grad2D(h00[i], x0, y0), grad2D(h10[i], x1, y0));
+            float b = lerp2D(u, grad2D(h01[i], x0, y1), grad2D(h11[i], x1, y1));
+            out[i] = lerp2D(v, a, b);
+        }
+    }
+
+#ifdef PERLIN_X86
+    // ----- SSE4.1: 4 lanes -----
+    PERLIN_TARGET("sse4.1")
+    static __m128 fadeSSE41(__m128 t) {
+        __m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))),
+                                  _mm_set1_ps(10.0f));
+        return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), inner);
+    }
+
+    PERLIN_TARGET("sse4.1")
+    static __m128 lerpSSE41(__m128 t, __m128 a, __m128 b) {
+        return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+    }
+
+    PERLIN_TARGET("sse4.1")
+    static __m128 gradSSE41(__m128i hash, __m128 x, __m128 y) {
+        __m128i h = _mm_and_si128(hash, _mm_set1_epi32(15));
+        __m128 lt8 = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(8)));
+        __m128 lt4 = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(4)));
+        __m128 h12or14 = _mm_castsi128_ps(_mm_or_si128(_mm_cmpeq_epi32(h, _mm_set1_epi32(12)),
+                                                       _mm_cmpeq_epi32(h, _mm_set1_epi32(14))));
+
+        __m128 u = _mm_blendv_ps(y, x, lt8);
+        __m128 v = _mm_blendv_ps(_mm_blendv_ps(_mm_setzero_ps(), x, h12or14), y, lt4);
+
+        // Bits 0 y 1 del hash → bit de signo de u y v
+        __m128 signU = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), 31));
+        __m128 signV = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), 30));
+        return _mm_add_ps(_mm_xor_ps(u, signU), _mm_xor_ps(v, signV));
+    }
+
+    template <bool SHARED_Y>
+    PERLIN_TARGET("sse4.1")
+    static void blockSSE41(const float* xs, const float* ys, size_t count,
+                           const int32_t* h00, const int32_t* h10, const int32_t* h01, const int32_t* h11,
+                           float* out) {
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        // Fila: y se prepara en escalar una vez, con las mismas operaciones que cada lane
+        float rowY0 = ys[0] - std::floor(ys[0]);
+        __m128 y0 = _mm_set1_ps(rowY0);
+        __m128 y1 = _mm_set1_ps(rowY0 - 1.0f);
+        __m128 fy = _mm_set1_ps(fade2D(rowY0));
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_loadu_ps(xs + i);
+            __m128 x0 = _mm_sub_ps(x, _mm_floor_ps(x));
+            __m128 x1 = _mm_sub_ps(x0, one);
+            __m128 u = fadeSSE41(x0);
+            if constexpr (!SHARED_Y) {
+                __m128 y = _mm_loadu_ps(ys + i);
+                y0 = _mm_sub_ps(y, _mm_floor_ps(y));
+                y1 = _mm_sub_ps(y0, one);
+                fy = fadeSSE41(y0);
+            }
+
+            __m128 a = lerpSSE41(u, gradSSE41(_mm_load_si128(reinterpret_cast<const __m128i*>(h00 + i)), x0, y0),
+                                    gradSSE41(_mm_load_si128(reinterpret_cast<const __m128i*>(h10 + i)), x1, y0));
+            __m128 b = lerpSSE41(u, gradSSE41(_mm_load_si128(reinterpret_cast<const __m128i*>(h01 + i)), x0, y1),
+                                    gradSSE41(_mm_load_si128(reinterpret_cast<const __m128i*>(h11 + i)), x1, y1));
+            _mm_storeu_ps(out + i, lerpSSE41(fy, a, b));
+        }
+
+        blockScalar<SHARED_Y>(xs + i, SHARED_Y ? ys : ys + i, count - i, h00 + i, h10 + i, h01 + i, h11 + i, out + i);
+    }
+
+    // ----- AVX2: 8 lanes -----
+    PERLIN_TARGET("avx2")
+    static __m256 fadeAVX2(__m256 t) {
+        __m256 inner = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)),
+                                                                    _mm256_set1_ps(15.0f))),
+                                     _mm256_set1_ps(10.0f));
+        return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), inner);
+    }
+
+    PERLIN_TARGET("avx2")
+    static __m256 lerpAVX2(__m256 t, __m256 a, __m256 b) {
+        return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+    }
+
+    PERLIN_TARGET("avx2")
+    static __m256 gradAVX2(__m256i hash, __m256 x, __m256 y) {
+        __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+        __m256 lt8 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), h));
+        __m256 lt4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+        __m256 h12or14 = _mm256_castsi256_ps(_mm256_or_si256(_mm256_cmpeq_epi32(h, _mm256_set1_epi32(12)),
+                                                             _mm256_cmpeq_epi32(h, _mm256_set1_epi32(14))));
+
+        __m256 u = _mm256_blendv_ps(y, x, lt8);
+        __m256 v = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_setzero_ps(), x, h12or14), y, lt4);
+
+        __m256 signU = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31));
+        __m256 signV = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30));
+        return _mm256_add_ps(_mm256_xor_ps(u, signU), _mm256_xor_ps(v, signV));
+    }
+
+    template <bool SHARED_Y>
+    PERLIN_TARGET("avx2")
+    static void blockAVX2(const float* xs, const float* ys, size_t count,
+                          const int32_t* h00, const int32_t* h10, const int32_t* h01, const int32_t* h11,
+                          float* out) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        // Fila: y se prepara en escalar una vez, con las mismas operaciones que cada lane
+        float rowY0 = ys[0] - std::floor(ys[0]);
+        __m256 y0 = _mm256_set1_ps(rowY0);
+        __m256 y1 = _mm256_set1_ps(rowY0 - 1.0f);
+        __m256 fy = _mm256_set1_ps(fade2D(rowY0));
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 x = _mm256_loadu_ps(xs + i);
+            __m256 x0 = _mm256_sub_ps(x, _mm256_floor_ps(x));
+            __m256 x1 = _mm256_sub_ps(x0, one);
+            __m256 u = fadeAVX2(x0);
+            if constexpr (!SHARED_Y) {
+                __m256 y = _mm256_loadu_ps(ys + i);
+                y0 = _mm256_sub_ps(y, _mm256_floor_ps(y));
+                y1 = _mm256_sub_ps(y0, one);
+                fy = fadeAVX2(y0);
+            }
+
+            __m256 a = lerpAVX2(u, gradAVX2(_mm256_load_si256(reinterpret_cast<const __m256i*>(h00 + i)), x0, y0),
+                                   gradAVX2(_mm256_load_si256(reinterpret_cast<const __m256i*>(h10 + i)), x1, y0));
+            __m256 b = lerpAVX2(u, gradAVX2(_mm256_load_si256(reinterpret_cast<const __m256i*>(h01 + i)), x0, y1),
+                                   gradAVX2(_mm256_load_si256(reinterpret_cast<const __m256i*>(h11 + i)), x1, y1));
+            _mm256_storeu_ps(out + i, lerpAVX2(fy, a, b));
+        }
+
+        blockSSE41<SHARED_Y>(xs + i, SHARED_Y ? ys : ys + i, count - i, h00 + i, h10 + i, h01 + i, h11 + i, out + i);
+    }
+
+    // ----- AVX-512: 16 lanes -----
+    PERLIN_TARGET("avx512f")
+    static __m512 fadeAVX512(__m512 t) {
+        __m512 inner = _mm512_add_ps(_mm512_mul_ps(t, _mm512_sub_ps(_mm512_mul_ps(t, _mm512_set1_ps(6.0f)),
+                                                                    _mm512_set1_ps(15.0f))),
+                                     _mm512_set1_ps(10.0f));
+        return _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(t, t), t), inner);
+    }
+
+    PERLIN_TARGET("avx512f")
+    static __m512 lerpAVX512(__m512 t, __m512 a, __m512 b) {
+        return _mm512_add_ps(a, _mm512_mul_ps(t, _mm512_sub_ps(b, a)));
+    }
+
+    PERLIN_TARGET("avx512f")
+    static __m512 gradAVX512(__m512i hash, __m512 x, __m512 y) {
+        __m512i h = _mm512_and_si512(hash, _mm512_set1_epi32(15));
+        __mmask16 lt8 = _mm512_cmplt_epi32_mask(h, _mm512_set1_epi32(8));
+        __mmask16 lt4 = _mm512_cmplt_epi32_mask(h, _mm512_set1_epi32(4));
+        __mmask16 h12or14 = _mm512_cmpeq_epi32_mask(h, _mm512_set1_epi32(12)) |
+                            _mm512_cmpeq_epi32_mask(h, _mm512_set1_epi32(14));
+
+        __m512 u = _mm512_mask_blend_ps(lt8, y, x);
+        __m512 v = _mm512_mask_blend_ps(lt4, _mm512_mask_blend_ps(h12or14, _mm512_setzero_ps(), x), y);
+
+        // AVX-512F no tiene xor de floats: se invierte el bit de signo sobre los enteros
+        const __m512i signBit = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+        __mmask16 negU = _mm512_test_epi32_mask(h, _mm512_set1_epi32(1));
+        __mmask16 negV = _mm512_test_epi32_mask(h, _mm512_set1_epi32(2));
+        __m512i ui = _mm512_castps_si512(u);
+        __m512i vi = _mm512_castps_si512(v);
+        return _mm512_add_ps(_mm512_castsi512_ps(_mm512_mask_xor_epi32(ui, negU, ui, signBit)),
+                             _mm512_castsi512_ps(_mm512_mask_xor_epi32(vi, negV, vi, signBit)));
+    }
+
+    template <bool SHARED_Y>
+    PERLIN_TARGET("avx512f")
+    static void blockAVX512(const float* xs, const float* ys, size_t count,
+                            const int32_t* h00, const int32_t* h10, const int32_t* h01, const int32_t* h11,
+                            float* out) {
+        const __m512 one = _mm512_set1_ps(1.0f);
+
+        // Fila: y se prepara en escalar una vez, con las mismas operaciones que cada lane
+        float rowY0 = ys[0] - std::floor(ys[0]);
+        __m512 y0 = _mm512_set1_ps(rowY0);
+        __m512 y1 = _mm512_set1_ps(rowY0 - 1.0f);
+        __m512 fy = _mm512_set1_ps(fade2D(rowY0));
+
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m512 x = _mm512_loadu_ps(xs + i);
+            __m512 x0 = _mm512_sub_ps(x, _mm512_mask_roundscale_ps(x, 0xFFFF, x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+            __m512 x1 = _mm512_sub_ps(x0, one);
+            __m512 u = fadeAVX512(x0);
+            if constexpr (!SHARED_Y) {
+                __m512 y = _mm512_loadu_ps(ys + i);
+                y0 = _mm512_sub_ps(y, _mm512_mask_roundscale_ps(y, 0xFFFF, y, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+                y1 = _mm512_sub_ps(y0, one);
+                fy = fadeAVX512(y0);
+            }
+
+            __m512 a = lerpAVX512(u, gradAVX512(_mm512_load_si512(h00 + i), x0, y0),
+                                     gradAVX512(_mm512_load_si512(h10 + i), x1, y0));
+            __m512 b = lerpAVX512(u, gradAVX512(_mm512_load_si512(h01 + i), x0, y1),
+                                     gradAVX512(_mm512_load_si512(h11 + i), x1, y1));
+            _mm512_storeu_ps(out + i, lerpAVX512(fy, a, b));
+        }
+
+        // El resto con AVX2: toda CPU con AVX-512F lo tiene
+        blockAVX2<SHARED_Y>(xs + i, SHARED_Y ? ys : ys + i, count - i, h00 + i, h10 + i, h01 + i, h11 + i, out + i);
+    }
+#endif
 };
\ No newline at end of file
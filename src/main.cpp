@@ -12,17 +12,113 @@
 #include "graphics/RenderSystem.hpp"
 
 #include <iostream>
+#include <fstream>
+#include <string>
+#include <stdexcept>
 #include <chrono>
+#include <cmath>
 #include <random>
 #include <thread>
 
-int main(){
-    // Semilla Aleatoria
-    std::random_device rd;
-    auto time_seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    auto thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
-    
-    uint64_t worldSeed = rd() ^ time_seed ^ (thread_id << 32);
+// Argumentos de la línea de comandos
+struct AppArguments {
+    bool hasSeed = false;
+    uint64_t seed = 0;
+    std::string directory;      // Vacío = directorio de chunks por defecto
+};
+
+// Parámetros de pregen.txt que tienen que coincidir para reutilizar los chunks pregenerados
+struct BakedWorld {
+    uint64_t seed = 0;
+    uint32_t chunkSize = 0;
+    uint32_t generatorVersion = 0;
+};
+
+static void PrintUsage() {
+    std::cout << "Uso: app [--seed <semilla>] [--dir <directorio>]\n"
+              << "Sin --seed la semilla es aleatoria; si --dir contiene un mundo de pregen se usa su semilla.\n";
+}
+
+static AppArguments ParseArguments(int argc, char** argv) {
+    AppArguments arguments;
+
+    auto value = [&](int& i) -> std::string {
+        if (i + 1 >= argc) throw std::invalid_argument(std::string("Falta el valor de ") + argv[i]);
+        return argv[++i];
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+
+        if (option == "--seed") {
+            arguments.seed = std::stoull(value(i));
+            arguments.hasSeed = true;
+        }
+        else if (option == "--dir") arguments.directory = value(i);
+        else throw std::invalid_argument("Opción desconocida: " + option);
+    }
+    return arguments;
+}
+
+static bool ReadBakedWorld(const std::string& directory, BakedWorld& world) {
+    std::ifstream manifest(directory + "/pregen.txt");
+    if (!manifest.is_open()) return false;
+
+    // Líneas clave=valor; las demás claves no afectan a la carga
+    std::string line;
+    while (std::getline(manifest, line)) {
+        size_t separator = line.find('=');
+        if (separator == std::string::npos) continue;
+
+        std::string key = line.substr(0, separator);
+        std::string value = line.substr(separator + 1);
+        if (key == "seed") world.seed = std::stoull(value);
+        else if (key == "chunkSize") world.chunkSize = static_cast<uint32_t>(std::stoul(value));
+        else if (key == "generatorVersion") world.generatorVersion = static_cast<uint32_t>(std::stoul(value));
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    const uint32_t chunkSize = 128;
+
+    AppArguments arguments;
+    try {
+        arguments = ParseArguments(argc, argv);
+
+        // Un mundo pregenerado fija la semilla: con otra, sus chunks se descartarían al cargarlos
+        BakedWorld baked;
+        if (!arguments.directory.empty() && ReadBakedWorld(arguments.directory, baked)) {
+            if (arguments.hasSeed && arguments.seed != baked.seed) {
+                throw std::invalid_argument("--seed no coincide con la semilla de " + arguments.directory + "/pregen.txt");
+            }
+            if (baked.chunkSize != chunkSize) {
+                throw std::invalid_argument("El mundo de " + arguments.directory + " usa chunks de " +
+                                            std::to_string(baked.chunkSize) + " tiles");
+            }
+            if (baked.generatorVersion != WorldGenerator::GENERATOR_VERSION) {
+                std::cout << "WARNING: " << arguments.directory << " se pregeneró con la versión "
+                          << baked.generatorVersion << " del generador (actual "
+                          << WorldGenerator::GENERATOR_VERSION << ")\n";
+            }
+            arguments.seed = baked.seed;
+            arguments.hasSeed = true;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << "\n";
+        PrintUsage();
+        return 1;
+    }
+
+    uint64_t worldSeed = arguments.seed;
+    if (!arguments.hasSeed) {
+        // Semilla Aleatoria
+        std::random_device rd;
+        auto time_seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        auto thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+        worldSeed = rd() ^ time_seed ^ (thread_id << 32);
+    }
 
     std::cout << "=== INICIALIZANDO SISTEMA ===\n";
     std::cout << "Semilla del mundo: " << worldSeed << "\n";
@@ -101,7 +197,9 @@ int main(){
     // -------------------------- Motor de mapas --------------------------
     std::cout << "Inicializando generador de mundo...\n";   
     LakeConfig Parametros_Lago (0.01f, -0.4f);
-    WorldSystem Map_Engine(Biome_Engine.getTodosBiomasID(), worldSeed, 128, Parametros_Lago, 6, 8, 500,1);
+    WorldSystem Map_Engine(Biome_Engine.getTodosBiomasID(), worldSeed, chunkSize, Parametros_Lago, 6, 8, 500,1);
+    Map_Engine.SetMemoryBudget(256u * 1024u * 1024u);     // Chunks residentes
+    if (!arguments.directory.empty()) Map_Engine.SetChunkDirectory(arguments.directory);
 
     // -------------------------- Motor grafico --------------------------
     // Configuración gráfica
@@ -131,49 +229,20 @@ int main(){
     std::cout << "  Rueda del ratón - Zoom\n";
     std::cout << "  ESC - Salir\n";
 
-    // ------------------------ Debug ------------------------
-    float timeSinceLastLoad = 60.0f;
-    const int maxRadius = 15; // Radio máximo de chunks a cargar
-    bool loadingMode = true; // true = cargando, false = descargando
-    DynamicArray<ChunkCoord> Debug_Coords;
-
-    for(int currentRadius = 0; currentRadius<=maxRadius; ++currentRadius){
-        if (currentRadius == 0) {
-            Debug_Coords.push_back(ChunkCoord(0, 0));
-
-        } else {
-
-            for (int x = -currentRadius; x <= currentRadius; ++x) {
-                Debug_Coords.push_back(ChunkCoord(x, -currentRadius));
-                Debug_Coords.push_back(ChunkCoord(x, currentRadius));
-            }
-            
-            // Lados izquierdo y derecho (sin incluir las esquinas ya procesadas)
-            for (int y = -currentRadius + 1; y <= currentRadius - 1; ++y) {
-                Debug_Coords.push_back(ChunkCoord(-currentRadius, y));
-                Debug_Coords.push_back(ChunkCoord(currentRadius, y));
-
-            }
-        }
-    }    
-
-    auto processChunk = [&](const ChunkCoord& coord, bool load) {
-        if (load) Graphics_Engine.updateChunk(coord, Map_Engine.LoadChunk(coord));
-        else {
-            // Descargar chunk
-            Graphics_Engine.removeChunk(coord);
-            Map_Engine.UnloadChunk(coord);
-        }
+    // ------------------------ Streaming de chunks ------------------------
+    // Un centro de actividad sigue a la cámara; los chunks entran y salen unos pocos por frame
+    const float chunkPixels = static_cast<float>(Map_Engine.GetChunkSize()) * config.tileSize;
+    auto cameraChunk = [&]() {
+        const glm::vec2& position = Graphics_Engine.getCamera().getPosition();
+        return ChunkCoord(static_cast<int>(std::floor(position.x / chunkPixels)),
+                          static_cast<int>(std::floor(position.y / chunkPixels)));
     };
 
-    auto processChunk_Stream = [&](const DynamicArray<ChunkCoord>& coords, bool load) {
-        if (load) Graphics_Engine.updateChunk(coords, Map_Engine.loadAllChunksInVector(coords));
-        else {
-            // Descargar chunk
-            Graphics_Engine.removeChunk(coords);
-            Map_Engine.UnloadAllChunksInVector(coords);
-        }
-    };
+    ChunkCoord Camera_Center = cameraChunk();
+    Map_Engine.Set_Center(Camera_Center);
+    StreamingBudget Stream_Budget;      // 4 ms, 8 cargas y 32 descargas por frame
+    Stream_Budget.generateAsync = true;  // La generación corre en el pool de workers
+
     // -------------------------------------------------------
     // Game loop principal
     while (!Graphics_Engine.shouldClose()) {
@@ -196,14 +265,19 @@ int main(){
         Graphics_Engine.processInput(deltaTime);
 
         // ------------------------ Logica del mundo -------------------------------
-        timeSinceLastLoad += deltaTime;
+        ChunkCoord Current_Center = cameraChunk();
+        if (Current_Center != Camera_Center) {
+            Map_Engine.Move_Center(Camera_Center, Current_Center);
+            Camera_Center = Current_Center;
+        }
 
-        if (timeSinceLastLoad >= 60.0f){
-            processChunk_Stream(Debug_Coords,loadingMode);
+        Map_Engine.UpdateStreaming(Stream_Budget);
+        for (const ChunkCoord& coord : Map_Engine.GetStreamedOut()) Graphics_Engine.removeChunk(coord);
+        for (const ChunkCoord& coord : Map_Engine.GetStreamedIn()) Graphics_Engine.updateChunk(coord, Map_Engine.LoadChunk(coord));
 
-            loadingMode = !loadingMode;        
-            timeSinceLastLoad = 0;
-        }
+        // Expulsión incremental si los chunks residentes superan el presupuesto
+        Map_Engine.EnforceMemoryBudget(0.002);
+        for (const ChunkCoord& coord : Map_Engine.GetBudgetEvicted()) Graphics_Engine.removeChunk(coord);
         // -------------------------------------------------------------------------
 
         // Renderizar el Frame
@@ -0,0 +1,222 @@
+#include <algorithm>
+
+#include "map/ActivityTracker.hpp"
+
+// ----- Constructores -----
+ActivityTracker::ActivityTracker(int simulation_distance, int keep_loaded_distance) :
+_simulation_distance(simulation_distance),
+_keep_loaded_distance(keep_loaded_distance),
+_cell_size(std::max(1, keep_loaded_distance)) {}
+
+// ----- Métodos -----
+
+// Centros
+bool ActivityTracker::AddCenter(const ChunkCoord& center) {
+    if (HasCenter(center)) return false;
+
+    InsertCenter(center);
+    ApplyCenterChange(nullptr, &center);
+    return true;
+}
+
+bool ActivityTracker::RemoveCenter(const ChunkCoord& center) {
+    if (!EraseCenter(center)) return false;
+
+    ApplyCenterChange(&center, nullptr);
+    return true;
+}
+
+bool ActivityTracker::MoveCenter(const ChunkCoord& from, const ChunkCoord& to) {
+    if (from == to) return HasCenter(from);
+    if (HasCenter(to) || !EraseCenter(from)) return false;
+
+    // Una sola pasada sobre ambos radios: sin zonas intermedias entre quitar y añadir
+    InsertCenter(to);
+    ApplyCenterChange(&from, &to);
+    return true;
+}
+
+bool ActivityTracker::HasCenter(const ChunkCoord& center) const {
+    const DynamicArray<ChunkCoord>* cell = _grid.find_ptr(CellOf(center));
+    if (cell == nullptr) return false;
+
+    for (const ChunkCoord& candidate : *cell) {
+        if (candidate == center) return true;
+    }
+    return false;
+}
+
+void ActivityTracker::GetCenters(DynamicArray<ChunkCoord>& out) const {
+    for (const auto& cell : _grid) {
+        for (const ChunkCoord& center : cell.second()) out.push_back(center);
+    }
+}
+
+// Chunks
+void ActivityTracker::AddChunk(const ChunkCoord& coord) {
+    if (_chunks.find_ptr(coord) != nullptr) return;
+
+    Entry& entry = _chunks[coord];
+    ++_evaluations;
+    SetDistance(coord, entry, NearestDistance(coord));
+}
+
+void ActivityTracker::RemoveChunk(const ChunkCoord& coord) {
+    _chunks.erase(coord);
+    _pending.erase(coord);
+}
+
+void ActivityTracker::Clear() {
+    _chunks.clear();
+    _pending.clear();
+}
+
+ActivityZone ActivityTracker::GetZone(const ChunkCoord& coord) const {
+    const Entry* entry = _chunks.find_ptr(coord);
+    return (entry != nullptr) ? entry->zone : ActivityZone::UNTRACKED;
+}
+
+float ActivityTracker::GetDistance(const ChunkCoord& coord) const {
+    const Entry* entry = _chunks.find_ptr(coord);
+    return (entry != nullptr) ? entry->distance : FarDistance();
+}
+
+void ActivityTracker::TakeEvents(DynamicArray<ZoneEvent>& out) {
+    for (const auto& pending : _pending) {
+        const Entry* entry = _chunks.find_ptr(pending.first());
+        if (entry == nullptr || entry->zone == pending.second()) continue;     // Volvió a su zona
+
+        out.push_back(ZoneEvent{pending.first(), pending.second(), entry->zone});
+    }
+    _pending.clear();
+}
+
+// ---------- Metodos privados ----------
+
+ActivityZone ActivityTracker::ZoneFor(float distance) const {
+    if (distance <= static_cast<float>(_simulation_distance)) return ActivityZone::ACTIVE;
+    if (distance <= static_cast<float>(_keep_loaded_distance)) return ActivityZone::DISTANT;
+    return ActivityZone::OUT_OF_RANGE;
+}
+
+ChunkCoord ActivityTracker::CellOf(const ChunkCoord& coord) const {
+    return ChunkCoord(FloorDiv(coord.x(), _cell_size), FloorDiv(coord.y(), _cell_size));
+}
+
+float ActivityTracker::NearestDistance(const ChunkCoord& coord) const {
+    // Con celdas de keep_loaded_distance, cualquier centro dentro de ese radio
+    // está en la celda del chunk o en una de sus 8 vecinas
+    DynamicArray<ChunkCoord> candidates;
+    GatherCenters(coord, 1, candidates);
+    return NearestDistance(coord, candidates);
+}
+
+float ActivityTracker::NearestDistance(const ChunkCoord& coord, const DynamicArray<ChunkCoord>& candidates) const {
+    float nearest = FarDistance();
+    for (const ChunkCoord& center : candidates) {
+        float distance = center.euclideanDistance(coord);
+        if (distance < nearest) nearest = distance;
+    }
+
+    return (nearest > static_cast<float>(_keep_loaded_distance)) ? FarDistance() : nearest;
+}
+
+void ActivityTracker::GatherCenters(const ChunkCoord& around, int cellRadius, DynamicArray<ChunkCoord>& out) const {
+    ChunkCoord cell = CellOf(around);
+    for (int dy = -cellRadius; dy <= cellRadius; ++dy) {
+        for (int dx = -cellRadius; dx <= cellRadius; ++dx) {
+            const DynamicArray<ChunkCoord>* centers = _grid.find_ptr(cell.getNeighbor(dx, dy));
+            if (centers == nullptr) continue;
+
+            for (const ChunkCoord& center : *centers) out.push_back(center);
+        }
+    }
+}
+
+void ActivityTracker::InsertCenter(const ChunkCoord& center) {
+    _grid[CellOf(center)].push_back(center);
+    ++_center_count;
+    ++_center_revision;
+}
+
+bool ActivityTracker::EraseCenter(const ChunkCoord& center) {
+    ChunkCoord cellCoord = CellOf(center);
+    DynamicArray<ChunkCoord>* cell = _grid.find_ptr(cellCoord);
+    if (cell == nullptr) return false;
+
+    for (size_t i = 0; i < cell->size(); ++i) {
+        if ((*cell)[i] != center) continue;
+
+        (*cell)[i] = cell->back();
+        cell->pop_back();
+        if (cell->empty()) _grid.erase(cellCoord);
+        --_center_count;
+        ++_center_revision;
+        return true;
+    }
+    return false;
+}
+
+void ActivityTracker::ApplyCenterChange(const ChunkCoord* removed, const ChunkCoord* added) {
+    // Un centro solo influye en los chunks a keep_loaded_distance o menos: se recorre
+    // el disco del centro quitado y luego el del añadido, sin repetir el solape
+    int radius = _keep_loaded_distance;
+    auto inDisc = [radius](const ChunkCoord& center, const ChunkCoord& coord) {
+        int dx = coord.x() - center.x();
+        int dy = coord.y() - center.y();
+        return dx * dx + dy * dy <= radius * radius;
+    };
+
+    // Los chunks del disco quitado solo pueden tener su nuevo centro más cercano
+    // a 2 * keep_loaded_distance del centro quitado: 5x5 celdas, reunidas una vez
+    DynamicArray<ChunkCoord> candidates;
+    if (removed != nullptr) GatherCenters(*removed, 2, candidates);
+
+    if (removed != nullptr) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            for (int dx = -radius; dx <= radius; ++dx) {
+                ChunkCoord coord = removed->getNeighbor(dx, dy);
+                if (!inDisc(*removed, coord)) continue;
+
+                Entry* entry = _chunks.find_ptr(coord);
+                if (entry == nullptr) continue;
+                ++_evaluations;
+
+                // Recalcular solo si el centro quitado era (o empataba como) el más cercano
+                if (entry->distance == removed->euclideanDistance(coord)) {
+                    SetDistance(coord, *entry, NearestDistance(coord, candidates));
+                } else if (added != nullptr && inDisc(*added, coord)) {
+                    float distance = added->euclideanDistance(coord);
+                    if (distance < entry->distance) SetDistance(coord, *entry, distance);
+                }
+            }
+        }
+    }
+
+    if (added != nullptr) {
+        for (int dy = -radius; dy <= radius; ++dy) {
+            for (int dx = -radius; dx <= radius; ++dx) {
+                ChunkCoord coord = added->getNeighbor(dx, dy);
+                if (!inDisc(*added, coord)) continue;
+                if (removed != nullptr && inDisc(*removed, coord)) continue;     // Ya evaluado
+
+                Entry* entry = _chunks.find_ptr(coord);
+                if (entry == nullptr) continue;
+                ++_evaluations;
+
+                float distance = added->euclideanDistance(coord);
+                if (distance < entry->distance) SetDistance(coord, *entry, distance);
+            }
+        }
+    }
+}
+
+void ActivityTracker::SetDistance(const ChunkCoord& coord, Entry& entry, float distance) {
+    entry.distance = distance;
+
+    ActivityZone zone = ZoneFor(distance);
+    if (zone == entry.zone) return;
+
+    if (_pending.find_ptr(coord) == nullptr) _pending[coord] = entry.zone;
+    entry.zone = zone;
+}
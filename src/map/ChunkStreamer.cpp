@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cmath>
+
+#include "map/ChunkStreamer.hpp"
+
+#include "data_structures/Unordered_map.hpp"
+
+// ----- Constructores -----
+ChunkStreamer::ChunkStreamer(int loadRadius) :
+_radius(std::max(0, loadRadius)) {
+    BuildOffsets();
+}
+
+// ----- Métodos -----
+void ChunkStreamer::SetRadius(int loadRadius) {
+    loadRadius = std::max(0, loadRadius);
+    if (loadRadius == _radius) return;
+
+    _radius = loadRadius;
+    BuildOffsets();
+}
+
+void ChunkStreamer::SetCenters(const DynamicArray<ChunkCoord>& centers) {
+    _queue.clear();
+    _cursor = 0;
+
+    // Anillo a anillo entre todos los centros: la cola queda ordenada por la
+    // distancia al centro más cercano y cada chunk aparece una sola vez
+    Unordered_map<ChunkCoord, bool> queued;
+    for (const ChunkCoord& offset : _offsets) {
+        for (const ChunkCoord& center : centers) {
+            ChunkCoord coord = center + offset;
+            if (queued.find_ptr(coord) != nullptr) continue;
+
+            queued[coord] = true;
+            _queue.push_back(coord);
+        }
+    }
+}
+
+bool ChunkStreamer::Next(ChunkCoord& coord) {
+    if (_cursor >= _queue.size()) return false;
+
+    coord = _queue[_cursor++];
+    return true;
+}
+
+// ---------- Metodos privados ----------
+
+void ChunkStreamer::BuildOffsets() {
+    _offsets.clear();
+    for (int dy = -_radius; dy <= _radius; ++dy) {
+        for (int dx = -_radius; dx <= _radius; ++dx) {
+            if (dx * dx + dy * dy <= _radius * _radius) _offsets.push_back(ChunkCoord(dx, dy));
+        }
+    }
+
+    // Espiral: por distancia y, dentro del mismo anillo, por ángulo
+    std::sort(_offsets.begin(), _offsets.end(), [](const ChunkCoord& a, const ChunkCoord& b) {
+        int da = a.x() * a.x() + a.y() * a.y();
+        int db = b.x() * b.x() + b.y() * b.y();
+        if (da != db) return da < db;
+        return std::atan2(a.y(), a.x()) < std::atan2(b.y(), b.x());
+    });
+}
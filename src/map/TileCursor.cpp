@@ -0,0 +1,50 @@
+#include <cstdlib>
+
+#include "map/TileCursor.hpp"
+
+// ----- Constructores -----
+TileCursor::TileCursor(WorldSystem& world, int worldX, int worldY) :
+_world(&world),
+_worldX(worldX),
+_worldY(worldY),
+_chunk_size(static_cast<int>(world.GetChunkSize())) {
+    Relocate();
+}
+
+// ---------- Metodos privados ----------
+
+void TileCursor::CrossBorder() {
+    int dcx = FloorDiv(_localX, _chunk_size);
+    int dcy = FloorDiv(_localY, _chunk_size);
+
+    // Saltos largos o chunk actual posiblemente descargado: resolver por el mapa
+    if (std::abs(dcx) > 1 || std::abs(dcy) > 1 || _epoch != _world->GetUnloadEpoch()) {
+        Relocate();
+        return;
+    }
+
+    if (!StepChunk(dcx, dcy)) Relocate();
+}
+
+void TileCursor::Relocate() {
+    int chunkX = FloorDiv(_worldX, _chunk_size);
+    int chunkY = FloorDiv(_worldY, _chunk_size);
+
+    _chunk = _world->AcquireChunk(ChunkCoord(chunkX, chunkY));
+    _epoch = _world->GetUnloadEpoch();
+    _localX = _worldX - chunkX * _chunk_size;
+    _localY = _worldY - chunkY * _chunk_size;
+}
+
+bool TileCursor::StepChunk(int dcx, int dcy) {
+    // Recorrer los enlaces de vecindad (en diagonal, primero en x y luego en y)
+    Chunk* next = _chunk;
+    if (dcx != 0) next = next->getNeighborChunk(dcx, 0);
+    if (next != nullptr && dcy != 0) next = next->getNeighborChunk(0, dcy);
+    if (next == nullptr) return false;
+
+    _chunk = next;
+    _localX -= dcx * _chunk_size;
+    _localY -= dcy * _chunk_size;
+    return true;
+}
@@ -1,4 +1,6 @@
 #include <stdexcept>
+#include <chrono>
+#include <memory>
 #include "map/WorldSystem.hpp"
 
 WorldSystem::WorldSystem(DynamicArray<int> BiomesID, 
@@ -9,11 +11,16 @@ WorldSystem::WorldSystem(DynamicArray<int> BiomesID,
                         float biomeRadiusInMeters,
                         float metersPerTile)
     : _Manager(chunkSize,worldSeed),
-      _Generator(BiomesID, worldSeed, biomeRadiusInMeters, metersPerTile),
+      _Generator(std::make_unique<WorldGenerator>(BiomesID, worldSeed, biomeRadiusInMeters, metersPerTile)),
       _simulation_distance(simulation_distance),
       _keep_loaded_distance(keep_loaded_distance),
       _biomeRadiusInMeters(biomeRadiusInMeters),
-      _metersPerTile(metersPerTile){};
+      _metersPerTile(metersPerTile),
+      _Activity_Tracker(std::make_unique<ActivityTracker>(simulation_distance, keep_loaded_distance)),
+      _Streamer(simulation_distance){
+  InstallBaselineProvider(worldSeed);
+  InstallResidencyListener();
+};
 
 
 WorldSystem::WorldSystem(DynamicArray<int> BiomesID, 
@@ -25,46 +32,60 @@ WorldSystem::WorldSystem(DynamicArray<int> BiomesID,
                         float biomeRadiusInMeters,
                         float metersPerTile)
     : _Manager(chunkSize, worldSeed),
-      _Generator(BiomesID, lake_config, worldSeed, biomeRadiusInMeters, metersPerTile),
+      _Generator(std::make_unique<WorldGenerator>(BiomesID, lake_config, worldSeed, biomeRadiusInMeters, metersPerTile)),
       _simulation_distance(simulation_distance),
       _keep_loaded_distance(keep_loaded_distance),
       _biomeRadiusInMeters(biomeRadiusInMeters),
-      _metersPerTile(metersPerTile){};
+      _metersPerTile(metersPerTile),
+      _Activity_Tracker(std::make_unique<ActivityTracker>(simulation_distance, keep_loaded_distance)),
+      _Streamer(simulation_distance){
+  InstallBaselineProvider(worldSeed);
+  InstallResidencyListener();
+};
 
 WorldSystem::WorldSystem(WorldSystem&& other) noexcept 
   :   _Manager(std::move(other._Manager)),
       _Generator(std::move(other._Generator)),
+      _Generation_Pool(std::move(other._Generation_Pool)),
+      _Generation_Threads(other._Generation_Threads),
+      _Chunk_Requests(std::move(other._Chunk_Requests)),
       _simulation_distance(std::move(other._simulation_distance)),
       _keep_loaded_distance(std::move(other._keep_loaded_distance)),
       _biomeRadiusInMeters(std::move(other._biomeRadiusInMeters)),
-      _metersPerTile(std::move(other._metersPerTile))  {};
+      _metersPerTile(std::move(other._metersPerTile)),
+      _Activity_Tracker(std::move(other._Activity_Tracker)),
+      _Far_Chunks(std::move(other._Far_Chunks)),
+      _Streamer(std::move(other._Streamer)),
+      _Stream_Center_Revision(other._Stream_Center_Revision),
+      _Stream_Epoch(other._Stream_Epoch),
+      _Stencil_Driver(std::move(other._Stencil_Driver))  {};
 
 // ----- Operadores -----
 WorldSystem& WorldSystem::operator=(WorldSystem&& other) noexcept {
   if (this != &other) {
+    // El pool propio se detiene antes de soltar el generador que usa
+    _Generation_Pool = std::move(other._Generation_Pool);
     _Generator = std::move(other._Generator);
+    _Generation_Threads = other._Generation_Threads;
+    _Chunk_Requests = std::move(other._Chunk_Requests);
     _Manager = std::move(other._Manager);
     _simulation_distance = std::move(other._simulation_distance);
     _keep_loaded_distance = std::move(other._keep_loaded_distance);
     _biomeRadiusInMeters = std::move(other._biomeRadiusInMeters);
     _metersPerTile = std::move(other._metersPerTile);
+    _Activity_Tracker = std::move(other._Activity_Tracker);
+    _Far_Chunks = std::move(other._Far_Chunks);
+    _Streamer = std::move(other._Streamer);
+    _Stream_Center_Revision = other._Stream_Center_Revision;
+    _Stream_Epoch = other._Stream_Epoch;
+    _Stencil_Driver = std::move(other._Stencil_Driver);
   }
   return *this;
 }
 
 // ----- Métodos Base -----
 Tile& WorldSystem::GetTile(int WorldX, int WorldY){
-  ChunkCoord coord = _Manager.WorldToChunkPos(WorldX,WorldY);
-  Chunk* Access_Chunk = _Manager.GetChunk(coord);
-  
-  if (Access_Chunk == nullptr){
-    std::unique_ptr<Chunk> New_Chunk = _Generator.generateChunk(coord, _Manager.getChunkSize());    
-    _Manager.SetChunk(coord, std::move(New_Chunk));
-
-    Access_Chunk = _Manager.GetChunk(coord);
-    Access_Chunk->setState(State::LOADED);
-  }
-
+  Chunk* Access_Chunk = AcquireChunk(_Manager.WorldToChunkPos(WorldX,WorldY));
   return _Manager.GetTile(WorldX, WorldY, Access_Chunk);
 }
 
@@ -75,38 +96,61 @@ const Tile& WorldSystem::GetTile(int WorldX, int WorldY) const{
   return _Manager.GetTile(WorldX, WorldY, Access_Chunk);
 }
 
+const Tile& WorldSystem::ReadTile(int WorldX, int WorldY){
+  // Lectura por el camino const: solo SetTile, WriteRegion y TileCursor::GetMutable ensucian el chunk
+  const Chunk* Access_Chunk = AcquireChunk(_Manager.WorldToChunkPos(WorldX,WorldY));
+  return static_cast<const ChunkManager&>(_Manager).GetTile(WorldX, WorldY, Access_Chunk);
+}
+
 const Chunk* WorldSystem::GetChunk(ChunkCoord coord) const{
   return _Manager.GetChunk(coord);
 }
 
-void WorldSystem::SetTile(int WorldX, int WorldY, const Tile& Value){
-  ChunkCoord coord = _Manager.WorldToChunkPos(WorldX,WorldY);
+Chunk* WorldSystem::AcquireChunk(ChunkCoord coord){
   Chunk* Access_Chunk = _Manager.GetChunk(coord);
-  
-  if (Access_Chunk == nullptr){
-    std::unique_ptr<Chunk> New_Chunk = _Generator.generateChunk(coord, _Manager.getChunkSize());    
-    _Manager.SetChunk(coord, std::move(New_Chunk));
 
-    Access_Chunk = _Manager.GetChunk(coord);
-    Access_Chunk->setState(State::LOADED);
+  if (Access_Chunk == nullptr){
+    std::unique_ptr<Chunk> New_Chunk = GenerateChunk(coord);
+    New_Chunk->setState(State::LOADED);
+    Access_Chunk = _Manager.SetChunk(coord, std::move(New_Chunk));
+    ResolveRequest(coord, Access_Chunk);
   }
 
+  return Access_Chunk;
+}
+
+void WorldSystem::SetTile(int WorldX, int WorldY, const Tile& Value){
+  Chunk* Access_Chunk = AcquireChunk(_Manager.WorldToChunkPos(WorldX,WorldY));
   _Manager.GetTile(WorldX, WorldY, Access_Chunk) = Value;
 }
 
 void WorldSystem::SetTile(int WorldX, int WorldY, Tile&& Value){
-  ChunkCoord coord = _Manager.WorldToChunkPos(WorldX,WorldY);
-  Chunk* Access_Chunk = _Manager.GetChunk(coord);
-  
-  if (Access_Chunk == nullptr){
-    std::unique_ptr<Chunk> New_Chunk = _Generator.generateChunk(coord, _Manager.getChunkSize());    
-    _Manager.SetChunk(coord, std::move(New_Chunk));
+  Chunk* Access_Chunk = AcquireChunk(_Manager.WorldToChunkPos(WorldX,WorldY));
+  _Manager.GetTile(WorldX, WorldY, Access_Chunk) = std::move(Value);
+}
 
-    Access_Chunk = _Manager.GetChunk(coord);
-    Access_Chunk->setState(State::LOADED);
-  }
+size_t WorldSystem::ReadRegion(const TileRect& rect, std::span<Tile> out, bool generateMissing){
+  if (generateMissing) AcquireRegion(rect);
+  return _Manager.ReadRegion(rect, out);
+}
 
-  _Manager.GetTile(WorldX, WorldY, Access_Chunk) = std::move(Value);
+size_t WorldSystem::ReadRegion(const TileRect& rect, std::span<Tile> out) const{
+  return _Manager.ReadRegion(rect, out);
+}
+
+size_t WorldSystem::WriteRegion(const TileRect& rect, std::span<const Tile> in){
+  AcquireRegion(rect);
+  return _Manager.WriteRegion(rect, in);
+}
+
+void WorldSystem::AcquireRegion(const TileRect& rect){
+  DynamicArray<ChunkCoord> coords;
+  _Manager.GetRegionChunks(rect, coords);
+
+  // Pedir al SO las lecturas de disco antes de resolver chunk a chunk
+  _Manager.PrefetchRegion(rect);
+  GenerateMissingChunks(coords);
+  for (const ChunkCoord& coord : coords) AcquireChunk(coord);
 }
 
 void WorldSystem::UnloadChunk(const ChunkCoord& coord){
@@ -122,9 +166,10 @@ const DynamicArray<DynamicArray<Tile>>& WorldSystem::LoadChunk(ChunkCoord coord)
   const Chunk* Access_Chunk = _Manager.GetChunk(coord);
   
   if (Access_Chunk == nullptr){
-    std::unique_ptr<Chunk> New_Chunk = _Generator.generateChunk(coord, _Manager.getChunkSize());    
+    std::unique_ptr<Chunk> New_Chunk = GenerateChunk(coord);
     New_Chunk->setState(State::LOADED);
     Access_Chunk = _Manager.Read_SetChunk(coord, std::move(New_Chunk));
+    ResolveRequest(coord, _Manager.FindChunk(coord));
   }
 
   return Access_Chunk->getAllTiles();
@@ -139,9 +184,10 @@ const DynamicArray<DynamicArray<Tile>>* WorldSystem::LoadChunk_ptr(ChunkCoord co
   const Chunk* Access_Chunk = _Manager.GetChunk(coord);
   
   if (Access_Chunk == nullptr){
-    std::unique_ptr<Chunk> New_Chunk = _Generator.generateChunk(coord, _Manager.getChunkSize());    
+    std::unique_ptr<Chunk> New_Chunk = GenerateChunk(coord);
     New_Chunk->setState(State::LOADED);
     Access_Chunk = _Manager.Read_SetChunk(coord, std::move(New_Chunk));
+    ResolveRequest(coord, _Manager.FindChunk(coord));
   }
 
   return Access_Chunk->getAllTiles_ptr();
@@ -156,10 +202,71 @@ const uint32_t& WorldSystem::GetChunkSize() const{
   return _Manager.getChunkSize();
 }
 
+// ------ Generacion asincrona ------
+std::shared_future<Chunk*> WorldSystem::RequestChunk(const ChunkCoord& coord, ChunkCallback callback){
+  ChunkRequest* Pending = _Chunk_Requests.find_ptr(coord);
+  if (Pending != nullptr){
+    if (callback) Pending->callbacks.push_back(std::move(callback));
+    return Pending->future;
+  }
+
+  // Residente, en caché o guardado: se resuelve ya, sin pasar por los workers
+  Chunk* Access_Chunk = _Manager.GetChunk(coord);
+  if (Access_Chunk != nullptr){
+    std::promise<Chunk*> Ready;
+    Ready.set_value(Access_Chunk);
+    if (callback) callback(*Access_Chunk);
+    return Ready.get_future().share();
+  }
+
+  if (!_Generation_Pool){
+    _Generation_Pool = std::make_unique<ChunkGenerationPool>(_Generator.get(), _Manager.getChunkSize(), _Generation_Threads);
+  }
+  _Generation_Pool->Submit(coord);
+
+  ChunkRequest Request;
+  Request.future = Request.promise.get_future().share();
+  if (callback) Request.callbacks.push_back(std::move(callback));
+
+  std::shared_future<Chunk*> Future = Request.future;
+  _Chunk_Requests.emplace(coord, std::move(Request));
+  return Future;
+}
+
+size_t WorldSystem::IntegrateGeneratedChunks(size_t maxChunks){
+  return IntegrateCompleted(maxChunks, nullptr);
+}
+
+void WorldSystem::WaitForGeneration(){
+  if (!_Generation_Pool) return;
+
+  // Los callbacks pueden pedir chunks nuevos: se repite hasta que no queda nada
+  while (!_Chunk_Requests.empty()){
+    _Generation_Pool->WaitIdle();
+    IntegrateCompleted(SIZE_MAX, nullptr);
+  }
+}
+
+void WorldSystem::SetGenerationThreads(size_t threads){
+  _Generation_Threads = threads;
+  if (!_Generation_Pool) return;
+
+  // Nada en vuelo se pierde: se integra antes de rehacer el pool
+  WaitForGeneration();
+  _Generation_Pool.reset();
+}
+
+size_t WorldSystem::GetGenerationThreads() const{
+  if (_Generation_Pool) return _Generation_Pool->GetThreadCount();
+  return _Generation_Threads;
+}
+
 // ------ Carga y descarga masiva ------
 DynamicArray<const DynamicArray<DynamicArray<Tile>>*> WorldSystem::loadAllChunksInVector(const DynamicArray<ChunkCoord>& Chunk_Array){
   DynamicArray<const DynamicArray<DynamicArray<Tile>>*> TileList;
 
+  // Los que falten se generan en lote; después todos están residentes
+  GenerateMissingChunks(Chunk_Array);
   for(int i = 0; i<static_cast<int>(Chunk_Array.size()); ++i){
     TileList.push_back(LoadChunk_ptr(Chunk_Array[i]));
   }
@@ -174,73 +281,238 @@ void WorldSystem::UnloadAllChunksInVector(const DynamicArray<ChunkCoord>& Chunk_
 
 // ------ Gestion de Chunks y estados ------
 void WorldSystem::DynamicChunkStates(){
-  _Distant_Chunks.clear();
+  DynamicArray<ZoneEvent> Events;
+  _Activity_Tracker->TakeEvents(Events);
 
-  for(auto Chunk_it = _Manager.begin(); Chunk_it!=_Manager.end(); ++Chunk_it){
-    
-    float minDistance = _keep_loaded_distance*2;
+  for(const ZoneEvent& Event: Events){
+    Chunk* Access_Chunk = _Manager.FindChunk(Event.coord);
+    if(Access_Chunk == nullptr) continue;
 
-    for(auto &Center: _Activity_Centers){
-      float Distance = Center.euclideanDistance(Chunk_it.coord());
-      if(Distance < minDistance) minDistance = Distance;
-    }
-
-    if(minDistance > _simulation_distance){
-      (*Chunk_it)->distant();
-      _Distant_Chunks.push_back(*Chunk_it);
+    if(Event.current == ActivityZone::ACTIVE){
+      Access_Chunk->activate();
     }else{
-      (*Chunk_it)->activate();
+      Access_Chunk->distant();
+      if(Event.current == ActivityZone::OUT_OF_RANGE) _Far_Chunks.push_back(Event.coord);
     }
   }
 }
 
-void WorldSystem::UnloadFarChunks(){
-  for(auto Chunk_it = _Distant_Chunks.begin(); Chunk_it!=_Distant_Chunks.end(); ++Chunk_it){
-    
-    float minDistance = _keep_loaded_distance*2;
+size_t WorldSystem::UpdateActiveChunks(uint32_t halo, const StencilKernel& kernel){
+  return _Stencil_Driver.Run(_Manager, halo, kernel);
+}
 
-    for(auto &Center: _Activity_Centers){
-      float Distance = Center.euclideanDistance((*Chunk_it)->getChunkCoord());
-      if(Distance < minDistance) minDistance = Distance;
-    }
+void WorldSystem::UnloadFarChunks(){
+  DynamicArray<ChunkCoord> Far_Chunks = std::move(_Far_Chunks);
+  _Far_Chunks = DynamicArray<ChunkCoord>();
 
-    if(minDistance > _keep_loaded_distance){
-      Chunk* Chunk_Pop = *Chunk_it;
-      _Distant_Chunks.erase(Chunk_it);
-      Chunk_Pop->isLoaded();
-      UnloadChunk(Chunk_Pop->getChunkCoord());
-    }
+  // Un centro pudo volver a acercarse desde que se marcó
+  for(const ChunkCoord& Coord: Far_Chunks){
+    if(_Activity_Tracker->GetZone(Coord) == ActivityZone::OUT_OF_RANGE) UnloadChunk(Coord);
   }
 }
 
 void WorldSystem::LoadActivityChunks(){
-  for(auto &Center: _Activity_Centers){
-    for(int i = -_simulation_distance; i<=_simulation_distance; ++i){
-      for(int j = -_simulation_distance; j<=_simulation_distance; ++j){
-        ChunkCoord Coord= Center.getNeighbor(i,j);
-        LoadChunk(Coord);
-      }
+  // Sin presupuesto: la cola del streamer ya viene sin duplicados entre centros
+  SyncStreamer();
+
+  ChunkCoord Coord;
+  while(_Streamer.Next(Coord)){
+    if(!_Manager.HasChunk(Coord)) LoadChunk(Coord);
+  }
+}
+
+size_t WorldSystem::UpdateStreaming(const StreamingBudget& budget){
+  auto Start = std::chrono::steady_clock::now();
+  auto Expired = [&]() {
+    return budget.seconds > 0.0 &&
+           std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count() >= budget.seconds;
+  };
+
+  _Streamed_In.clear();
+  _Streamed_Out.clear();
+  SyncStreamer();
+
+  // Descargas: chunks que pasaron keep_loaded_distance (histéresis frente al radio de carga)
+  DynamicChunkStates();
+  while(!_Far_Chunks.empty() && _Streamed_Out.size() < budget.maxUnloads && !Expired()){
+    ChunkCoord Coord = _Far_Chunks.back();
+    _Far_Chunks.pop_back();
+
+    if(_Activity_Tracker->GetZone(Coord) != ActivityZone::OUT_OF_RANGE) continue;
+    UnloadChunk(Coord);
+    _Streamed_Out.push_back(Coord);
+  }
+
+  // Chunks que terminaron los workers desde el último frame
+  if(budget.generateAsync) IntegrateCompleted(budget.maxLoads, &_Streamed_In);
+
+  // Cargas en espiral; los chunks ya residentes o en vuelo solo cuestan una búsqueda
+  size_t Loads = 0;
+  ChunkCoord Coord;
+  while(Loads < budget.maxLoads && !Expired() && _Streamer.Next(Coord)){
+    if(_Manager.HasChunk(Coord) || _Chunk_Requests.find_ptr(Coord) != nullptr) continue;
+    ++Loads;
+
+    if(budget.generateAsync){
+      // Desde caché o disco se resuelve en el acto; si no, llega en un frame posterior
+      RequestChunk(Coord);
+      if(_Manager.HasChunk(Coord)) _Streamed_In.push_back(Coord);
+    }else{
+      LoadChunk(Coord);
+      _Streamed_In.push_back(Coord);
     }
   }
+
+  // Estado de los recién cargados; nuestras propias descargas no reinician la cola
+  DynamicChunkStates();
+  _Stream_Epoch = _Manager.GetUnloadEpoch();
+
+  return _Streamed_In.size() + _Streamed_Out.size();
+}
+
+// ------ Presupuesto de memoria ------
+size_t WorldSystem::EnforceMemoryBudget(double timeBudgetSeconds){
+  DynamicArray<ChunkCoord> centers;
+  _Activity_Tracker->GetCenters(centers);
+
+  _Budget_Evicted.clear();
+  return _Manager.EnforceMemoryBudget(centers, timeBudgetSeconds, &_Budget_Evicted);
 }
 
 // ------ Gestion de centros de actividad ------
 void WorldSystem::Set_Center(ChunkCoord coord) {
-  for(const auto &center: _Activity_Centers){
-    if(center == coord) return;
-  }
-  _Activity_Centers.push_back(coord);
-
-  return;
+  _Activity_Tracker->AddCenter(coord);
 };
 
 void WorldSystem::Set_Erase_Center(ChunkCoord coord) {
-  for(auto i = _Activity_Centers.begin(); i!=_Activity_Centers.end(); ++i){
-    if (*i == coord){
-      _Activity_Centers.erase(i);
-        return;
+  _Activity_Tracker->RemoveCenter(coord);
+};
+
+void WorldSystem::Move_Center(ChunkCoord from, ChunkCoord to) {
+  _Activity_Tracker->MoveCenter(from, to);
+};
+
+
+// ------ Generacion ------
+std::unique_ptr<Chunk> WorldSystem::GenerateChunk(const ChunkCoord& coord) {
+  // El coste medido decide si compensa guardar chunks sin modificar (PersistPolicy::ADAPTIVE)
+  // Si ya lo empezó un worker se espera a ese resultado en vez de generarlo dos veces
+  if (_Generation_Pool){
+    GeneratedChunk Claimed;
+    if (_Generation_Pool->Claim(coord, Claimed)){
+      _Manager.RecordGenerationTime(Claimed.seconds);
+      return std::move(Claimed.chunk);
     }
   }
 
-  return;
-};
+  auto start = std::chrono::steady_clock::now();
+  std::unique_ptr<Chunk> New_Chunk = _Generator->generateChunk(coord, _Manager.getChunkSize());
+  _Manager.RecordGenerationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+  return New_Chunk;
+}
+
+void WorldSystem::GenerateMissingChunks(const DynamicArray<ChunkCoord>& coords) {
+  DynamicArray<ChunkCoord> Missing;
+  Unordered_map<ChunkCoord, bool> Queued;
+
+  for (const ChunkCoord& coord : coords) {
+    if (Queued.find_ptr(coord) != nullptr || _Manager.GetChunk(coord) != nullptr) continue;
+
+    // Los que ya empezó un worker se recogen de ahí
+    GeneratedChunk Claimed;
+    if (_Generation_Pool && _Generation_Pool->Claim(coord, Claimed)){
+      _Manager.RecordGenerationTime(Claimed.seconds);
+      Claimed.chunk->setState(State::LOADED);
+      ResolveRequest(coord, _Manager.SetChunk(coord, std::move(Claimed.chunk)));
+      continue;
+    }
+
+    Queued.emplace(coord, true);
+    Missing.push_back(coord);
+  }
+  if (Missing.empty()) return;
+
+  auto start = std::chrono::steady_clock::now();
+  DynamicArray<std::unique_ptr<Chunk>> Generated =
+      _Generator->generateChunks(std::span<const ChunkCoord>(Missing.data(), Missing.size()), _Manager.getChunkSize());
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // El coste se reparte por igual entre los chunks del lote
+  for (size_t i = 0; i < Missing.size(); ++i) {
+    _Manager.RecordGenerationTime(seconds / static_cast<double>(Missing.size()));
+    ResolveRequest(Missing[i], _Manager.SetChunk(Missing[i], std::move(Generated[i])));
+  }
+}
+
+size_t WorldSystem::IntegrateCompleted(size_t maxChunks, DynamicArray<ChunkCoord>* integrated) {
+  if (!_Generation_Pool) return 0;
+
+  DynamicArray<GeneratedChunk> Completed;
+  _Generation_Pool->TakeCompleted(Completed, maxChunks);
+
+  for (GeneratedChunk& Generated : Completed) {
+    ChunkCoord Coord = Generated.chunk->getChunkCoord();
+    _Manager.RecordGenerationTime(Generated.seconds);
+
+    Chunk* Access_Chunk = _Manager.FindChunk(Coord);
+    if (Access_Chunk == nullptr) {
+      Generated.chunk->setState(State::LOADED);
+      Access_Chunk = _Manager.SetChunk(Coord, std::move(Generated.chunk));
+      if (integrated != nullptr) integrated->push_back(Coord);
+    }
+    ResolveRequest(Coord, Access_Chunk);
+  }
+
+  return Completed.size();
+}
+
+void WorldSystem::ResolveRequest(const ChunkCoord& coord, Chunk* chunk) {
+  ChunkRequest* Pending = _Chunk_Requests.find_ptr(coord);
+  if (Pending == nullptr) return;
+
+  // Fuera del mapa antes de avisar: un callback puede volver a pedir chunks
+  ChunkRequest Request = std::move(*Pending);
+  _Chunk_Requests.erase(coord);
+
+  Request.promise.set_value(chunk);
+  for (ChunkCallback& Callback : Request.callbacks) Callback(*chunk);
+}
+
+void WorldSystem::InstallBaselineProvider(uint64_t worldSeed) {
+  // Las ediciones se guardan como diferencias frente a la generación procedural.
+  // generateChunk es pura y reentrante: un generador propio, que el lambda mantiene
+  // vivo aunque el manager se destruya después de _Generator, con la misma cache
+  // de semillas. La llamada es segura desde el hilo de E/S.
+  auto baseline = std::make_shared<WorldGenerator>(_Generator->getBiomeIds(), _Generator->getLakeConfig(),
+                                                   worldSeed, _biomeRadiusInMeters, _metersPerTile);
+  baseline->setSeedCache(_Generator->getSeedCache());
+
+  _Manager.SetGeneratorVersion(WorldGenerator::GENERATOR_VERSION);
+  _Manager.SetBaselineProvider([baseline](const ChunkCoord& coord, uint32_t chunkSize) {
+    return baseline->generateChunk(coord, chunkSize);
+  });
+}
+
+void WorldSystem::InstallResidencyListener() {
+  // El tracker vive en el heap: el puntero sigue siendo válido si se mueve el WorldSystem
+  ActivityTracker* Tracker = _Activity_Tracker.get();
+  _Manager.SetResidencyListener([Tracker](const ChunkCoord& coord, bool resident) {
+    if (resident) Tracker->AddChunk(coord);
+    else Tracker->RemoveChunk(coord);
+  });
+}
+
+void WorldSystem::SyncStreamer() {
+  // Centros cambiados: nueva cola. Descargas ajenas (presupuesto de memoria, UnloadChunk):
+  // algún chunk deseado pudo salir, se vuelve a revisar la cola desde el principio
+  if (_Activity_Tracker->GetCenterRevision() != _Stream_Center_Revision) {
+    DynamicArray<ChunkCoord> Centers;
+    _Activity_Tracker->GetCenters(Centers);
+    _Streamer.SetCenters(Centers);
+    _Stream_Center_Revision = _Activity_Tracker->GetCenterRevision();
+  } else if (_Manager.GetUnloadEpoch() != _Stream_Epoch) {
+    _Streamer.Restart();
+  }
+  _Stream_Epoch = _Manager.GetUnloadEpoch();
+}
@@ -0,0 +1,156 @@
+#include <utility>
+#include <chrono>
+
+#include "map/generator/ChunkGenerationPool.hpp"
+
+// ----- Constructores -----
+ChunkGenerationPool::ChunkGenerationPool(WorldGenerator* generator, uint32_t chunkSize, size_t threadCount) :
+_generator(generator),
+_chunk_size(chunkSize) {
+    if (threadCount == 0) {
+        // Un núcleo queda para el hilo dueño (game loop y render)
+        size_t hardware = std::thread::hardware_concurrency();
+        threadCount = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        _workers.push_back(std::thread(&ChunkGenerationPool::Run, this));
+    }
+}
+
+// ----- Destructor -----
+ChunkGenerationPool::~ChunkGenerationPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _work_available.notify_all();
+
+    for (std::thread& worker : _workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+// ----- Métodos -----
+bool ChunkGenerationPool::Submit(const ChunkCoord& coord) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_jobs.find_ptr(coord) != nullptr) return false;
+
+        _jobs.emplace(coord, Job());
+        _queue.enqueue(coord);
+    }
+    _work_available.notify_one();
+    return true;
+}
+
+bool ChunkGenerationPool::IsInFlight(const ChunkCoord& coord) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _jobs.find_ptr(coord) != nullptr;
+}
+
+size_t ChunkGenerationPool::TakeCompleted(DynamicArray<GeneratedChunk>& out, size_t maxChunks) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    size_t taken = 0;
+    while (taken < maxChunks && !_completed.empty()) {
+        ChunkCoord coord = _completed.extract();
+
+        // Entrada obsoleta: Claim ya lo entregó (y quizá se volvió a pedir)
+        Job* job = _jobs.find_ptr(coord);
+        if (job == nullptr || job->chunk == nullptr) continue;
+
+        GeneratedChunk result;
+        result.chunk = std::move(job->chunk);
+        result.seconds = job->seconds;
+        _jobs.erase(coord);
+
+        out.push_back(std::move(result));
+        ++taken;
+    }
+
+    return taken;
+}
+
+bool ChunkGenerationPool::Claim(const ChunkCoord& coord, GeneratedChunk& out) {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    Job* job = _jobs.find_ptr(coord);
+    if (job == nullptr) return false;
+
+    if (!job->started) {
+        _jobs.erase(coord);     // La entrada de _queue queda obsoleta y se ignora
+        return false;
+    }
+
+    _work_done.wait(lock, [&] {
+        Job* current = _jobs.find_ptr(coord);
+        return current == nullptr || current->chunk != nullptr;
+    });
+
+    job = _jobs.find_ptr(coord);
+    if (job == nullptr) return false;
+
+    out.chunk = std::move(job->chunk);
+    out.seconds = job->seconds;
+    _jobs.erase(coord);         // La entrada de _completed queda obsoleta
+    return true;
+}
+
+void ChunkGenerationPool::WaitIdle() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _work_done.wait(lock, [&] { return _queue.empty() && _running == 0; });
+}
+
+size_t ChunkGenerationPool::GetInFlightCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _jobs.size();
+}
+
+size_t ChunkGenerationPool::GetRunningCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _running;
+}
+
+size_t ChunkGenerationPool::GetGeneratedCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _generated;
+}
+
+// ---------- Metodos privados ----------
+
+void ChunkGenerationPool::Run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true) {
+        _work_available.wait(lock, [&] { return _stop || !_queue.empty(); });
+        if (_stop) break;
+
+        ChunkCoord coord = _queue.extract();
+        Job* job = _jobs.find_ptr(coord);
+        if (job == nullptr || job->started) {
+            // Cancelado por Claim o entrada repetida tras volver a pedirse
+            if (_queue.empty()) _work_done.notify_all();
+            continue;
+        }
+
+        job->started = true;
+        ++_running;
+
+        lock.unlock();
+        auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<Chunk> chunk = _generator->generateChunk(coord, _chunk_size);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        lock.lock();
+
+        // Un trabajo empezado no se cancela: Claim espera a que termine
+        job = _jobs.find_ptr(coord);
+        job->chunk = std::move(chunk);
+        job->seconds = seconds;
+        _completed.enqueue(coord);
+
+        --_running;
+        ++_generated;
+        _work_done.notify_all();
+    }
+}
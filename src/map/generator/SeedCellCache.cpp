@@ -0,0 +1,97 @@
+#include <algorithm>
+
+#include "map/generator/SeedCellCache.hpp"
+#include "utils/CounterRng.hpp"
+
+// ----- Métodos -----
+void SeedCellCache::insert(int64_t cellIndex, DynamicArray<BiomeSeed>&& seeds) {
+    Shard& shard = shardFor(cellIndex);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    // Otro hilo pudo calcularla antes: el contenido es el mismo
+    if (shard.cells.find_ptr(cellIndex) != nullptr) return;
+
+    uint64_t tick = _clock.fetch_add(1, std::memory_order_relaxed) + 1;
+    shard.seedBytes += seeds.capacity() * sizeof(BiomeSeed);
+    shard.cells.emplace(cellIndex, Cell(std::move(seeds), tick));
+
+    // Se descarta por lotes hasta 3/4 del límite: el recorrido del shard se amortiza
+    size_t maxCells = capacity();
+    if (maxCells == 0) return;
+    size_t shardLimit = (maxCells + SHARD_COUNT - 1) / SHARD_COUNT;
+    if (shard.cells.size() > shardLimit) evictLeastRecent(shard, shardLimit - shardLimit / 4);
+}
+
+bool SeedCellCache::contains(int64_t cellIndex) const {
+    const Shard& shard = shardFor(cellIndex);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.cells.find_ptr(cellIndex) != nullptr;
+}
+
+void SeedCellCache::clear() {
+    for (Shard& shard : _shards) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.cells.clear();
+        shard.seedBytes = 0;
+    }
+}
+
+size_t SeedCellCache::size() const {
+    size_t total = 0;
+    for (const Shard& shard : _shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        total += shard.cells.size();
+    }
+    return total;
+}
+
+size_t SeedCellCache::memoryUsage() const {
+    // Nodo de la tabla: par clave/celda más enlaces y entrada del índice
+    constexpr size_t NODE_BYTES = sizeof(Pair<int64_t, Cell>) + 4 * sizeof(void*);
+
+    size_t total = sizeof(SeedCellCache);
+    for (const Shard& shard : _shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        total += shard.cells.size() * NODE_BYTES + shard.seedBytes;
+    }
+    return total;
+}
+
+// ---------- Metodos privados ----------
+
+void SeedCellCache::evictLeastRecent(Shard& shard, size_t keep) {
+    struct Candidate {
+        uint64_t lastUse;
+        int64_t cellIndex;
+    };
+
+    DynamicArray<Candidate> candidates;
+    candidates.reserve(shard.cells.size());
+    for (auto it = shard.cells.begin(); it != shard.cells.end(); ++it) {
+        candidates.push_back(Candidate{it->second().lastUse.load(std::memory_order_relaxed), it->first()});
+    }
+
+    size_t excess = candidates.size() - keep;
+    std::nth_element(candidates.data(), candidates.data() + excess, candidates.data() + candidates.size(),
+                     [](const Candidate& a, const Candidate& b) { return a.lastUse < b.lastUse; });
+
+    for (size_t i = 0; i < excess; ++i) {
+        const Cell* cell = shard.cells.find_ptr(candidates[i].cellIndex);
+        shard.seedBytes -= cell->seeds.capacity() * sizeof(BiomeSeed);
+        shard.cells.erase(candidates[i].cellIndex);
+    }
+    _evictions.fetch_add(excess, std::memory_order_relaxed);
+}
+
+SeedCellCache::Shard& SeedCellCache::shardFor(int64_t cellIndex) {
+    return _shards[shardIndex(cellIndex)];
+}
+
+const SeedCellCache::Shard& SeedCellCache::shardFor(int64_t cellIndex) const {
+    return _shards[shardIndex(cellIndex)];
+}
+
+size_t SeedCellCache::shardIndex(int64_t cellIndex) {
+    // Mezcla splitmix64: celdas vecinas caen en shards distintos
+    return static_cast<size_t>(CounterRng::mix(static_cast<uint64_t>(cellIndex) + 0x9E3779B97F4A7C15ull) % SHARD_COUNT);
+}
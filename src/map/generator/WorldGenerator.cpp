@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <numbers>
 #include <iostream>
+#include <span>
 
 #include "map/generator/WorldGenerator.hpp"
 
@@ -11,7 +12,6 @@ WorldGenerator::WorldGenerator(const DynamicArray<int>& biomeIds,
                              float biomeRadiusInMeters, 
                              float metersPerTile) 
     : _worldSeed(worldSeed), 
-      _rng(_worldSeed),
       _biomeIds(biomeIds) {
     
     // Validación básica
@@ -22,6 +22,7 @@ WorldGenerator::WorldGenerator(const DynamicArray<int>& biomeIds,
     _biomeRadius = biomeRadiusInMeters / metersPerTile;
     updateCellSize();
     _globalNoise = PerlinNoise(_worldSeed);
+    _seedCache = std::make_shared<SeedCellCache>();
 }
 
 WorldGenerator::WorldGenerator(const DynamicArray<int>& biomeIds, 
@@ -30,7 +31,6 @@ WorldGenerator::WorldGenerator(const DynamicArray<int>& biomeIds,
                              float biomeRadiusInMeters, 
                              float metersPerTile)
     : _worldSeed(worldSeed), 
-      _rng(_worldSeed),
       _lakeConfig(lake_config),
       _biomeIds(biomeIds) {
     
@@ -41,14 +41,16 @@ WorldGenerator::WorldGenerator(const DynamicArray<int>& biomeIds,
     _biomeRadius = biomeRadiusInMeters / metersPerTile;
     updateCellSize();
     _globalNoise = PerlinNoise(_worldSeed);
+    _seedCache = std::make_shared<SeedCellCache>();
 }
 
 WorldGenerator::WorldGenerator(WorldGenerator&& other) noexcept
     : _worldSeed(other._worldSeed),
-      _rng(std::move(other._rng)),
       _biomeRadius(other._biomeRadius),
       _cellSize(other._cellSize),
-      _seedGrid(std::move(other._seedGrid)),
+      _seedCache(std::move(other._seedCache)),
+      _biomePruning(other._biomePruning),
+      _biomeHierarchy(other._biomeHierarchy),
       _lakeConfig(std::move(other._lakeConfig)),
       _globalNoise(std::move(other._globalNoise)),
       _biomeIds(std::move(other._biomeIds)) {}
@@ -57,10 +59,11 @@ WorldGenerator::WorldGenerator(WorldGenerator&& other) noexcept
 WorldGenerator& WorldGenerator::operator=(WorldGenerator&& other) noexcept {
     if (this != &other) {
         _worldSeed = other._worldSeed;
-        _rng = std::move(other._rng);
         _biomeRadius = other._biomeRadius;
         _cellSize = other._cellSize;
-        _seedGrid = std::move(other._seedGrid);
+        _seedCache = std::move(other._seedCache);
+        _biomePruning = other._biomePruning;
+        _biomeHierarchy = other._biomeHierarchy;
         _lakeConfig = std::move(other._lakeConfig);
         _globalNoise = std::move(other._globalNoise);
         _biomeIds = std::move(other._biomeIds);
@@ -69,76 +72,78 @@ WorldGenerator& WorldGenerator::operator=(WorldGenerator&& other) noexcept {
 }
 
 // ----- Métodos públicos -----
-std::unique_ptr<Chunk> WorldGenerator::generateChunk(ChunkCoord coord, uint32_t chunkSize) {
-    auto chunk = std::make_unique<Chunk>(coord, chunkSize);
-    
-    // Generar semillas para esta región (con margen)
-    generateSeedsForRegion(coord, chunkSize);
-    
-    // Asignar biomas
-    assignBiomesToChunk(*chunk);
-    
-    // Generar lagos
-    generateLakes(*chunk);
-    
-    chunk->setState(State::LOADED);
-    
-    return chunk;
+std::unique_ptr<Chunk> WorldGenerator::generateChunk(ChunkCoord coord, uint32_t chunkSize) const {
+    // Un lote de uno: mismo camino que generateChunks, mismo resultado
+    const ChunkCoord coords[1] = { coord };
+    DynamicArray<std::unique_ptr<Chunk>> chunks = generateChunks(std::span<const ChunkCoord>(coords, 1), chunkSize);
+    return std::move(chunks[0]);
 }
 
-std::unique_ptr<Chunk> WorldGenerator::generateChunk(int chunkX, int chunkY, uint32_t chunkSize) {
+std::unique_ptr<Chunk> WorldGenerator::generateChunk(int chunkX, int chunkY, uint32_t chunkSize) const {
     ChunkCoord coord(chunkX,chunkY);
     return generateChunk(coord,chunkSize);
 }
 
+DynamicArray<std::unique_ptr<Chunk>> WorldGenerator::generateChunks(std::span<const ChunkCoord> coords,
+                                                                    uint32_t chunkSize) const {
+    DynamicArray<std::unique_ptr<Chunk>> result;
+    result.reserve(coords.size());
+    for (size_t i = 0; i < coords.size(); ++i) result.push_back(std::unique_ptr<Chunk>());
+
+    // División con redondeo hacia abajo: las regiones no se parten en el eje
+    auto region = [](int value) {
+        return value >= 0 ? value / SUPER_REGION_CHUNKS : -((-(value + 1)) / SUPER_REGION_CHUNKS) - 1;
+    };
+
+    // Orden por región y, dentro de ella, por filas: los chunks contiguos quedan seguidos
+    DynamicArray<uint32_t> order;
+    order.reserve(coords.size());
+    for (size_t i = 0; i < coords.size(); ++i) order.push_back(static_cast<uint32_t>(i));
+
+    std::sort(order.data(), order.data() + order.size(), [&](uint32_t a, uint32_t b) {
+        const ChunkCoord& left = coords[a];
+        const ChunkCoord& right = coords[b];
+        if (region(left.y()) != region(right.y())) return region(left.y()) < region(right.y());
+        if (region(left.x()) != region(right.x())) return region(left.x()) < region(right.x());
+        if (left.y() != right.y()) return left.y() < right.y();
+        if (left.x() != right.x()) return left.x() < right.x();
+        return a < b;
+    });
+
+    const uint32_t* first = order.data();
+    const uint32_t* end = order.data() + order.size();
+    while (first != end) {
+        const uint32_t* last = first + 1;
+        while (last != end && region(coords[*last].x()) == region(coords[*first].x()) &&
+               region(coords[*last].y()) == region(coords[*first].y())) {
+            ++last;
+        }
+
+        generateSuperRegion(coords, first, last, chunkSize, result);
+        first = last;
+    }
+
+    return result;
+}
+
 // Setters
 void WorldGenerator::setWorldSeed(uint64_t worldSeed) {
     _worldSeed = worldSeed;
-    _rng.seed(_worldSeed);
     _globalNoise = PerlinNoise(_worldSeed);
-    _seedGrid.clear();  // Reiniciar grid
+    _seedCache = std::make_shared<SeedCellCache>(_seedCache->capacity());     // Nueva: otros generadores pueden compartir la anterior
 }
 
 void WorldGenerator::setBiomeRadius(float radiusInMeters, float metersPerTile) {
     _biomeRadius = radiusInMeters / metersPerTile;
     updateCellSize();
-    _seedGrid.clear();  // Reiniciar grid
+    _seedCache = std::make_shared<SeedCellCache>(_seedCache->capacity());
 }
 
 // ----- Metodos Poisson Disk -----
 // Generacion de semillas
-void WorldGenerator::generateSeedsForRegion(const ChunkCoord& coord, uint32_t chunkSize) {
-    // Convertir coordenadas de chunk a tiles del mundo
-    float minTileX = static_cast<float>(coord.x() * chunkSize);
-    float minTileY = static_cast<float>(coord.y() * chunkSize);
-    float maxTileX = minTileX + static_cast<float>(chunkSize);
-    float maxTileY = minTileY + static_cast<float>(chunkSize);
-    
-    // Expandir región para incluir semillas vecinas
-    float expand = _biomeRadius * 2.0f;
-    
-    // Calcular celdas que cubren la región expandida
-    Pair<int, int> startCell = worldToCellCoords(minTileX - expand, minTileY - expand);
-    Pair<int, int> endCell = worldToCellCoords(maxTileX + expand, maxTileY + expand);
-    
-    // Generar semillas para cada celda necesaria
-    for (int cellY = startCell.second(); cellY <= endCell.second(); ++cellY) {
-        for (int cellX = startCell.first(); cellX <= endCell.first(); ++cellX) {
-            int64_t cellIndex = calculateCellIndex(cellX, cellY);
-            
-            // Solo generar si no existe
-            if (!_seedGrid.contains(cellIndex)) {
-                generateSeedsForCell(cellX, cellY);
-            }
-        }
-    }
-}
-
-void WorldGenerator::generateSeedsForCell(int cellX, int cellY) {
-    auto cellRng = createCellRNG(cellX, cellY);
-    
-    std::uniform_real_distribution<float> posDist(0.0f, _cellSize);
-    std::uniform_real_distribution<float> strengthDist(0.5f, 2.0f);
+void WorldGenerator::generateCandidatesForCell(int cellX, int cellY, DynamicArray<SeedCandidate>& out) const {
+    CounterRng cellRng = createCellRNG(cellX, cellY);
+    uint32_t biomeCount = static_cast<uint32_t>(_biomeIds.size());
     
     // CORRECCIÓN: Manejar correctamente coordenadas negativas
     float cellWorldX = static_cast<float>(cellX) * _cellSize;
@@ -148,68 +153,145 @@ void WorldGenerator::generateSeedsForCell(int cellX, int cellY) {
     float cellCenterX = cellWorldX + (_cellSize / 2.0f);
     float cellCenterY = cellWorldY + (_cellSize / 2.0f);
     
-    DynamicArray<BiomeSeed> seeds;
-    
-    std::uniform_int_distribution<int> countDist(1, 3);
-    int attempts = countDist(cellRng);
+    int attempts = 1 + static_cast<int>(cellRng.nextBelow(3));
+    int64_t cellIndex = calculateCellIndex(cellX, cellY);
     
+    // Cada intento consume siempre cinco valores: la candidata i no depende de las demás
     for (int i = 0; i < attempts; ++i) {
-        float offsetX = posDist(cellRng) - (_cellSize / 2.0f);
-        float offsetY = posDist(cellRng) - (_cellSize / 2.0f);
+        float offsetX = cellRng.nextFloat(0.0f, _cellSize) - (_cellSize / 2.0f);
+        float offsetY = cellRng.nextFloat(0.0f, _cellSize) - (_cellSize / 2.0f);
+        int biomeId = _biomeIds[cellRng.nextBelow(biomeCount)];
+        float strength = cellRng.nextFloat(0.5f, 2.0f);
+        uint64_t priority = cellRng();
         
         // Posición absoluta en el mundo (puede ser negativa)
-        float seedX = cellCenterX + offsetX;
-        float seedY = cellCenterY + offsetY;
-        
-        if (isValidSeedPosition(seedX, seedY, cellX, cellY)) {
-            std::uniform_int_distribution<size_t> biomeDist(0, _biomeIds.size() - 1);
-            int biomeId = _biomeIds[biomeDist(cellRng)];
-            float strength = strengthDist(cellRng);
-            
-            seeds.push_back(BiomeSeed(biomeId, seedX, seedY, strength));
-        }
+        BiomeSeed seed(biomeId, cellCenterX + offsetX, cellCenterY + offsetY, strength);
+        out.push_back(SeedCandidate{seed, priority, cellIndex, i});
     }
+}
+
+void WorldGenerator::selectSeedsForCell(int cellX, int cellY, CandidateMemo& memo,
+                                        DynamicArray<BiomeSeed>& out) const {
+    int count = static_cast<int>(candidateCell(cellX, cellY, memo).candidates.size());
     
-    if (!seeds.empty()) {
-        _seedGrid[calculateCellIndex(cellX, cellY)] = std::move(seeds);
+    for (int i = 0; i < count; ++i) {
+        if (isCandidateAccepted(cellX, cellY, i, memo)) {
+            out.push_back(candidateCell(cellX, cellY, memo).candidates[i].seed);
+        }
     }
 }
 
-
-bool WorldGenerator::isValidSeedPosition(float tileX, float tileY, int cellX, int cellY) const {
-    float minDistSq = _biomeRadius * _biomeRadius;
+bool WorldGenerator::isCandidateAccepted(int cellX, int cellY, int ordinal, CandidateMemo& memo) const {
+    // Las referencias a la memo no sobreviven a la recursión: se copia lo necesario
+    int8_t state = candidateCell(cellX, cellY, memo).accepted[ordinal];
+    if (state >= 0) return state == 1;
     
-    // Verificar celdas vecinas 3x3
-    for (int dy = -1; dy <= 1; ++dy) {
-        for (int dx = -1; dx <= 1; ++dx) {
-            int neighborCellX = cellX + dx;
-            int neighborCellY = cellY + dy;
-            
-            int64_t neighborIndex = calculateCellIndex(neighborCellX, neighborCellY);
-            auto it = _seedGrid.find_ptr(neighborIndex);
+    SeedCandidate candidate = candidateCell(cellX, cellY, memo).candidates[ordinal];
+    float minDistSq = _biomeRadius * _biomeRadius;
+    int reach = conflictReach();
+    bool accepted = true;
+    
+    // Solo cuentan las vecinas prioritarias que a su vez quedaron aceptadas. La
+    // recursión siempre sube de prioridad, así que termina y no forma ciclos.
+    for (int dy = -reach; dy <= reach && accepted; ++dy) {
+        for (int dx = -reach; dx <= reach && accepted; ++dx) {
+            int neighborX = cellX + dx;
+            int neighborY = cellY + dy;
+            int count = static_cast<int>(candidateCell(neighborX, neighborY, memo).candidates.size());
             
-            if (it != nullptr) {
-                for (const BiomeSeed& seed : *it) {
-                    float dx2 = tileX - seed.x;
-                    float dy2 = tileY - seed.y;
-                    float distSq = dx2 * dx2 + dy2 * dy2;
-                    
-                    if (distSq < minDistSq) {
-                        return false;  // Colisión
-                    }
+            for (int k = 0; k < count; ++k) {
+                SeedCandidate other = candidateCell(neighborX, neighborY, memo).candidates[k];
+                if (!outranks(other, candidate)) continue;
+                
+                float dx2 = candidate.seed.x - other.seed.x;
+                float dy2 = candidate.seed.y - other.seed.y;
+                if (dx2 * dx2 + dy2 * dy2 >= minDistSq) continue;
+                
+                if (isCandidateAccepted(neighborX, neighborY, k, memo)) {
+                    accepted = false;  // Colisión con una semilla prioritaria
+                    break;
                 }
             }
         }
     }
     
-    return true;
+    candidateCell(cellX, cellY, memo).accepted[ordinal] = accepted ? 1 : 0;
+    return accepted;
 }
 
-// Asignacion
-void WorldGenerator::assignBiomesToChunk(Chunk& chunk) {
-    // Obtener semillas relevantes para este chunk
-    auto seeds = collectSeedsForChunk(chunk);
+WorldGenerator::CandidateCell& WorldGenerator::candidateCell(int cellX, int cellY, CandidateMemo& memo) const {
+    int64_t cellIndex = calculateCellIndex(cellX, cellY);
+    
+    CandidateCell* cell = memo.find_ptr(cellIndex);
+    if (cell != nullptr) return *cell;
+    
+    CandidateCell fresh;
+    generateCandidatesForCell(cellX, cellY, fresh.candidates);
+    fresh.accepted = DynamicArray<int8_t>(fresh.candidates.size(), -1);
+    memo.emplace(cellIndex, std::move(fresh));
     
+    return *memo.find_ptr(cellIndex);
+}
+
+bool WorldGenerator::outranks(const SeedCandidate& a, const SeedCandidate& b) {
+    // Orden total: prioridad y, en caso de empate, identidad de la candidata
+    if (a.priority != b.priority) return a.priority > b.priority;
+    if (a.cellIndex != b.cellIndex) return a.cellIndex > b.cellIndex;
+    return a.ordinal > b.ordinal;
+}
+
+int WorldGenerator::conflictReach() const {
+    // Con _cellSize = r / sqrt(2) hacen falta dos celdas de margen
+    return static_cast<int>(std::ceil(_biomeRadius / _cellSize));
+}
+
+// Asignacion
+void WorldGenerator::assignBiomesToChunk(Chunk& chunk, const DynamicArray<BiomeSeed>& seeds) const {
+    if (_biomePruning) {
+        uint32_t chunkSize = chunk.getChunkSize();
+
+        // Buffers compartidos por todas las regiones y bloques del chunk
+        DynamicArray<double> upper(seeds.size(), 0.0);
+        DynamicArray<uint32_t> survivors(seeds.size(), 0u);
+        DynamicArray<uint32_t> regionSeeds(seeds.size(), 0u);
+        DynamicArray<uint32_t> allSeeds(seeds.size(), 0u);
+        for (size_t i = 0; i < seeds.size(); ++i) allSeeds[i] = static_cast<uint32_t>(i);
+
+        if (!_biomeHierarchy) {
+            for (uint32_t blockY = 0; blockY < chunkSize; blockY += BIOME_BLOCK) {
+                for (uint32_t blockX = 0; blockX < chunkSize; blockX += BIOME_BLOCK) {
+                    assignBiomesToBlock(chunk, blockX, blockY, seeds, allSeeds.data(), seeds.size(), false,
+                                        upper, survivors);
+                }
+            }
+            return;
+        }
+
+        // Las semillas que no pueden ganar en la región tampoco ganan en ninguno de sus bloques
+        for (uint32_t regionY = 0; regionY < chunkSize; regionY += BIOME_REGION) {
+            for (uint32_t regionX = 0; regionX < chunkSize; regionX += BIOME_REGION) {
+                uint32_t width = std::min(BIOME_REGION, chunkSize - regionX);
+                uint32_t height = std::min(BIOME_REGION, chunkSize - regionY);
+                Pair<int, int> origin = chunk.localToWorld(static_cast<int>(regionX), static_cast<int>(regionY));
+
+                size_t regionCount = pruneSeeds(seeds, allSeeds.data(), seeds.size(),
+                                                static_cast<float>(origin.first()),
+                                                static_cast<float>(origin.second()),
+                                                static_cast<float>(origin.first() + static_cast<int>(width) - 1),
+                                                static_cast<float>(origin.second() + static_cast<int>(height) - 1),
+                                                upper.data(), regionSeeds.data());
+
+                for (uint32_t blockY = regionY; blockY < regionY + height; blockY += BIOME_BLOCK) {
+                    for (uint32_t blockX = regionX; blockX < regionX + width; blockX += BIOME_BLOCK) {
+                        assignBiomesToBlock(chunk, blockX, blockY, seeds, regionSeeds.data(), regionCount, true,
+                                            upper, survivors);
+                    }
+                }
+            }
+        }
+        return;
+    }
+
     // Procesar cada tile del chunk
     for (uint32_t y = 0; y < chunk.getChunkSize(); ++y) {
         for (uint32_t x = 0; x < chunk.getChunkSize(); ++x) {
@@ -226,50 +308,241 @@ void WorldGenerator::assignBiomesToChunk(Chunk& chunk) {
     }
 }
 
-DynamicArray<BiomeSeed> WorldGenerator::collectSeedsForChunk(const Chunk& chunk) const {
-    DynamicArray<BiomeSeed> result;
+// Solo las candidatas que sobreviven a la poda del bloque se evalúan tile a tile. Con una
+// sola superviviente (fillUniform) el bloque entero es suyo: las demás quedan por debajo
+// de su influencia mínima con margen, así que no ganan ni con el redondeo de float.
+void WorldGenerator::assignBiomesToBlock(Chunk& chunk, uint32_t blockX, uint32_t blockY,
+                                         const DynamicArray<BiomeSeed>& seeds,
+                                         const uint32_t* candidates, size_t candidateCount, bool fillUniform,
+                                         DynamicArray<double>& upper, DynamicArray<uint32_t>& survivors) const {
+    uint32_t chunkSize = chunk.getChunkSize();
+    uint32_t width = std::min(BIOME_BLOCK, chunkSize - blockX);
+    uint32_t height = std::min(BIOME_BLOCK, chunkSize - blockY);
+    Pair<int, int> origin = chunk.localToWorld(static_cast<int>(blockX), static_cast<int>(blockY));
+
+    size_t survivorCount = pruneSeeds(seeds, candidates, candidateCount,
+                                      static_cast<float>(origin.first()),
+                                      static_cast<float>(origin.second()),
+                                      static_cast<float>(origin.first() + static_cast<int>(width) - 1),
+                                      static_cast<float>(origin.second() + static_cast<int>(height) - 1),
+                                      upper.data(), survivors.data());
+
+    if (fillUniform && survivorCount == 1) {
+        int biomeId = seeds[survivors[0]].biomeId;
+        for (uint32_t y = 0; y < height; ++y) {
+            Tile* row = chunk.getRowData(blockY + y);
+            for (uint32_t x = 0; x < width; ++x) row[blockX + x].setBiomeId(biomeId);
+        }
+        return;
+    }
+
+    // Tiles del bloque en arrays planos: el bucle interno no tiene ramas y se vectoriza
+    constexpr uint32_t BLOCK_TILES = BIOME_BLOCK * BIOME_BLOCK;
+    float tileX[BLOCK_TILES], tileY[BLOCK_TILES], best[BLOCK_TILES];
+    int bestBiome[BLOCK_TILES];
+
+    uint32_t count = width * height;
+    for (uint32_t t = 0; t < count; ++t) {
+        tileX[t] = static_cast<float>(origin.first() + static_cast<int>(t % width));
+        tileY[t] = static_cast<float>(origin.second() + static_cast<int>(t / width));
+        best[t] = -1.0f;
+        bestBiome[t] = _biomeIds[0];
+    }
+
+    for (size_t k = 0; k < survivorCount; ++k) {
+        const BiomeSeed& seed = seeds[survivors[k]];
+        float seedX = seed.x, seedY = seed.y, strength = seed.strength;
+        int biomeId = seed.biomeId;
+
+        // Mismas operaciones que calculateBiomeInfluence
+        for (uint32_t t = 0; t < count; ++t) {
+            float dx = tileX[t] - seedX;
+            float dy = tileY[t] - seedY;
+            float influence = strength / (1.0f + (dx * dx + dy * dy) * 0.0001f);
+
+            bool better = influence > best[t];
+            best[t] = better ? influence : best[t];
+            bestBiome[t] = better ? biomeId : bestBiome[t];
+        }
+    }
+
+    for (uint32_t y = 0; y < height; ++y) {
+        Tile* row = chunk.getRowData(blockY + y);
+        for (uint32_t x = 0; x < width; ++x) {
+            row[blockX + x].setBiomeId(bestBiome[y * width + x]);
+        }
+    }
+}
+
+// Una semilla cuya influencia máxima en el rectángulo queda por debajo de la mínima de otra
+// no gana en ningún tile y se descarta. Las supervivientes conservan su orden, así los
+// empates se resuelven igual que en selectDominantBiome y el resultado es idéntico.
+size_t WorldGenerator::pruneSeeds(const DynamicArray<BiomeSeed>& seeds, const uint32_t* candidates,
+                                  size_t candidateCount, float minX, float minY, float maxX, float maxY,
+                                  double* upper, uint32_t* out) {
+    // Margen relativo muy por encima del error de redondeo de la influencia en float
+    constexpr double PRUNE_MARGIN = 1e-4;
+
+    double bestLower = -1.0;
+    for (size_t i = 0; i < candidateCount; ++i) {
+        Pair<double, double> bounds = influenceBounds(seeds[candidates[i]], minX, minY, maxX, maxY);
+        upper[i] = bounds.second();
+        if (bounds.first() > bestLower) bestLower = bounds.first();
+    }
+
+    double cutoff = bestLower * (1.0 - PRUNE_MARGIN);
+    size_t survivorCount = 0;
+    for (size_t i = 0; i < candidateCount; ++i) {
+        if (upper[i] >= cutoff) out[survivorCount++] = candidates[i];
+    }
+    return survivorCount;
+}
+
+// Influencia mínima y máxima de la semilla sobre el rectángulo de tiles (en double)
+Pair<double, double> WorldGenerator::influenceBounds(const BiomeSeed& seed, float minX, float minY,
+                                                     float maxX, float maxY) {
+    double seedX = seed.x, seedY = seed.y;
+
+    double nearX = std::max(0.0, std::max(minX - seedX, seedX - maxX));
+    double nearY = std::max(0.0, std::max(minY - seedY, seedY - maxY));
+    double farX = std::max(std::abs(seedX - minX), std::abs(seedX - maxX));
+    double farY = std::max(std::abs(seedY - minY), std::abs(seedY - maxY));
+
+    double lower = seed.strength / (1.0 + (farX * farX + farY * farY) * 0.0001);
+    double upper = seed.strength / (1.0 + (nearX * nearX + nearY * nearY) * 0.0001);
+    return {lower, upper};
+}
+
+WorldGenerator::SeedWindow WorldGenerator::seedWindow(ChunkCoord coord, uint32_t chunkSize) const {
+    SeedWindow window;
     
     // CORRECCIÓN: Usar int64_t para evitar problemas de signo
-    int64_t chunkX = chunk.getChunkCoord().x();
-    int64_t chunkY = chunk.getChunkCoord().y();
-    uint32_t chunkSize = chunk.getChunkSize();
+    int64_t chunkX = coord.x();
+    int64_t chunkY = coord.y();
     
-    float minTileX = static_cast<float>(chunkX * chunkSize);
-    float minTileY = static_cast<float>(chunkY * chunkSize);
-    float maxTileX = minTileX + static_cast<float>(chunkSize);
-    float maxTileY = minTileY + static_cast<float>(chunkSize);
+    window.minTileX = static_cast<float>(chunkX * chunkSize);
+    window.minTileY = static_cast<float>(chunkY * chunkSize);
+    window.maxTileX = window.minTileX + static_cast<float>(chunkSize);
+    window.maxTileY = window.minTileY + static_cast<float>(chunkSize);
     
-    float expand = _biomeRadius * 2.0f;
+    window.expand = _biomeRadius * 2.0f;
     
-    Pair<int, int> startCell = worldToCellCoords(minTileX - expand, minTileY - expand);
-    Pair<int, int> endCell = worldToCellCoords(maxTileX + expand, maxTileY + expand);
+    Pair<int, int> startCell = worldToCellCoords(window.minTileX - window.expand, window.minTileY - window.expand);
+    Pair<int, int> endCell = worldToCellCoords(window.maxTileX + window.expand, window.maxTileY + window.expand);
+    window.startCellX = startCell.first();
+    window.startCellY = startCell.second();
+    window.endCellX = endCell.first();
+    window.endCellY = endCell.second();
     
-    for (int cellY = startCell.second(); cellY <= endCell.second(); ++cellY) {
-        for (int cellX = startCell.first(); cellX <= endCell.first(); ++cellX) {
+    return window;
+}
+
+void WorldGenerator::gatherSeedGrid(int startCellX, int startCellY, int endCellX, int endCellY, SeedGrid& grid) const {
+    grid.cellX0 = startCellX;
+    grid.cellY0 = startCellY;
+    grid.width = endCellX - startCellX + 1;
+    grid.height = endCellY - startCellY + 1;
+    grid.cells.reserve(static_cast<size_t>(grid.width) * static_cast<size_t>(grid.height));
+    
+    // Candidatas de las celdas que falten en la cache y de sus vecinas, compartidas por toda la región
+    CandidateMemo memo;
+    
+    for (int cellY = startCellY; cellY <= endCellY; ++cellY) {
+        for (int cellX = startCellX; cellX <= endCellX; ++cellX) {
             int64_t cellIndex = calculateCellIndex(cellX, cellY);
-            auto it = _seedGrid.find_ptr(cellIndex);
             
-            if (it != nullptr) {
-                for (const BiomeSeed& seed : *it) {
-                    // Usar el mismo margen expandido
-                    if (seed.x >= (minTileX - expand) && seed.x <= (maxTileX + expand) &&
-                        seed.y >= (minTileY - expand) && seed.y <= (maxTileY + expand)) {
-                        result.push_back(seed);
-                    }
+            // Copia: la cache puede descartar la celda mientras se usa la rejilla
+            DynamicArray<BiomeSeed> seeds;
+            bool cached = _seedCache->visit(cellIndex, [&](const DynamicArray<BiomeSeed>& stored) {
+                seeds = DynamicArray<BiomeSeed>(stored.begin(), stored.end());
+            });
+            
+            if (!cached) {
+                selectSeedsForCell(cellX, cellY, memo, seeds);
+                _seedCache->insert(cellIndex, DynamicArray<BiomeSeed>(seeds.begin(), seeds.end()));
+            }
+            grid.cells.push_back(std::move(seeds));
+        }
+    }
+}
+
+DynamicArray<BiomeSeed> WorldGenerator::collectSeedsForChunk(const Chunk& chunk, const SeedGrid& grid) const {
+    DynamicArray<BiomeSeed> result;
+    SeedWindow window = seedWindow(chunk.getChunkCoord(), chunk.getChunkSize());
+    
+    // Mismo recorrido de celdas que si el chunk se generase solo: el orden de las semillas
+    // decide los empates de influencia
+    for (int cellY = window.startCellY; cellY <= window.endCellY; ++cellY) {
+        for (int cellX = window.startCellX; cellX <= window.endCellX; ++cellX) {
+            size_t cell = static_cast<size_t>(cellY - grid.cellY0) * static_cast<size_t>(grid.width) +
+                          static_cast<size_t>(cellX - grid.cellX0);
+            
+            for (const BiomeSeed& seed : grid.cells[cell]) {
+                // Usar el mismo margen expandido
+                if (seed.x >= (window.minTileX - window.expand) && seed.x <= (window.maxTileX + window.expand) &&
+                    seed.y >= (window.minTileY - window.expand) && seed.y <= (window.maxTileY + window.expand)) {
+                    result.push_back(seed);
                 }
             }
         }
     }
     
     if (result.empty()) {
-        float centerX = (minTileX + maxTileX) / 2.0f;
-        float centerY = (minTileY + maxTileY) / 2.0f;
+        float centerX = (window.minTileX + window.maxTileX) / 2.0f;
+        float centerY = (window.minTileY + window.maxTileY) / 2.0f;
         result.push_back(BiomeSeed(_biomeIds[0], centerX, centerY, 1.0f));
     }
     
     return result;
 }
 
+void WorldGenerator::generateSuperRegion(std::span<const ChunkCoord> coords, const uint32_t* first,
+                                         const uint32_t* last, uint32_t chunkSize,
+                                         DynamicArray<std::unique_ptr<Chunk>>& out) const {
+    DynamicArray<Chunk*> chunks;
+    chunks.reserve(static_cast<size_t>(last - first));
+    
+    // Celdas que cubren las ventanas de todos los chunks de la región
+    SeedWindow bounds = seedWindow(coords[*first], chunkSize);
+    for (const uint32_t* index = first; index != last; ++index) {
+        out[*index] = std::make_unique<Chunk>(coords[*index], chunkSize);
+        chunks.push_back(out[*index].get());
+        
+        SeedWindow window = seedWindow(coords[*index], chunkSize);
+        bounds.startCellX = std::min(bounds.startCellX, window.startCellX);
+        bounds.startCellY = std::min(bounds.startCellY, window.startCellY);
+        bounds.endCellX = std::max(bounds.endCellX, window.endCellX);
+        bounds.endCellY = std::max(bounds.endCellY, window.endCellY);
+    }
+    
+    SeedGrid grid;
+    gatherSeedGrid(bounds.startCellX, bounds.startCellY, bounds.endCellX, bounds.endCellY, grid);
+    
+    // Asignar biomas con las semillas que afectan a cada chunk
+    for (Chunk* chunk : chunks) {
+        DynamicArray<BiomeSeed> seeds = collectSeedsForChunk(*chunk, grid);
+        assignBiomesToChunk(*chunk, seeds);
+    }
+    
+    // Generar lagos por tramos de chunks contiguos de una fila
+    size_t runStart = 0;
+    for (size_t i = 1; i <= chunks.size(); ++i) {
+        if (i < chunks.size()) {
+            ChunkCoord previous = chunks[i - 1]->getChunkCoord();
+            ChunkCoord current = chunks[i]->getChunkCoord();
+            if (current.y() == previous.y() && current.x() == previous.x() + 1) continue;
+        }
+        
+        generateLakes(std::span<Chunk* const>(chunks.data() + runStart, i - runStart));
+        runStart = i;
+    }
+    
+    for (Chunk* chunk : chunks) {
+        chunk->setState(State::LOADED);
+        chunk->markClean();     // Reproducible desde (seed, coord): no hace falta guardarlo
+    }
+}
+
 int WorldGenerator::selectDominantBiome(float tileX, float tileY, 
                                       const DynamicArray<BiomeSeed>& seeds) const {
     int bestBiomeId = _biomeIds[0];  // Default al primer bioma
@@ -297,25 +570,69 @@ float WorldGenerator::calculateBiomeInfluence(const BiomeSeed& seed,
 }
 
 // ----- Métodos de Generación de Lagos  -----
-void WorldGenerator::generateLakes(Chunk& chunk) {
+void WorldGenerator::generateLakes(std::span<Chunk* const> run) const {
+    uint32_t chunkSize = run[0]->getChunkSize();
+    uint32_t width = chunkSize * static_cast<uint32_t>(run.size());
+    Pair<int, int> origin = run[0]->localToWorld(0, 0);
+    
+    // Las x de ruido son las mismas en todas las filas: se calculan una vez
+    DynamicArray<float> noiseX(width, 0.0f);
+    DynamicArray<float> lakeNoise(width, 0.0f);
+    for (uint32_t x = 0; x < width; ++x) {
+        noiseX[x] = static_cast<float>(origin.first() + static_cast<int>(x)) * _lakeConfig.scale;
+    }
     
-    for (uint32_t y = 0; y < chunk.getChunkSize(); ++y) {
-        for (uint32_t x = 0; x < chunk.getChunkSize(); ++x) {
-            Pair<int, int> worldPos = chunk.localToWorld(x, y);
-            float worldX = static_cast<float>(worldPos.first());
-            float worldY = static_cast<float>(worldPos.second());
-            
-            // RUIDO PERLIN SIMPLE - solo esto
-            float lakeNoise = _globalNoise.noise(
-                worldX * _lakeConfig.scale, 
-                worldY * _lakeConfig.scale, 
-                0.0f
-            );
-            
-            if (lakeNoise < _lakeConfig.threshold) {
-                Tile& tile = chunk.at(x, y);
-                tile.setHasWater(true);
-                
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        float worldY = static_cast<float>(origin.second() + static_cast<int>(y));
+        
+        // RUIDO PERLIN SIMPLE - una fila de todo el tramo por llamada
+        _globalNoise.noise2D(std::span<const float>(noiseX.data(), width), worldY * _lakeConfig.scale,
+                             std::span<float>(lakeNoise.data(), width));
+        
+        for (size_t c = 0; c < run.size(); ++c) {
+            const float* values = lakeNoise.data() + c * chunkSize;
+            Tile* row = run[c]->getRowData(y);
+            for (uint32_t x = 0; x < chunkSize; ++x) {
+                if (values[x] < _lakeConfig.threshold) row[x].setHasWater(true);
+            }
+        }
+    }
+
+    if (_lakeConfig.riverWidth > 0.0f) generateRivers(run);
+}
+
+void WorldGenerator::generateRivers(std::span<Chunk* const> run) const {
+    uint32_t chunkSize = run[0]->getChunkSize();
+    uint32_t width = chunkSize * static_cast<uint32_t>(run.size());
+    Pair<int, int> origin = run[0]->localToWorld(0, 0);
+
+    // Desplazado para no repetir el dominio de los lagos con la misma permutación
+    FractalConfig river(FractalType::RIDGED, _lakeConfig.riverScale, 3);
+    river.offsetX = 101.7f;
+    river.offsetY = -33.9f;
+    river.warpStrength = _lakeConfig.riverMeander;
+    river.warpFrequency = _lakeConfig.riverScale * 2.0f;
+
+    // Filas anchas (todo el tramo) en bandas de pocas filas: los buffers de octavas y
+    // warp siguen en cache aunque el tramo sea largo. Cada tile solo depende de su posición.
+    constexpr uint32_t RIVER_BAND = 16;
+    uint32_t bandRows = std::min(RIVER_BAND, chunkSize);
+    DynamicArray<float> ridges(static_cast<size_t>(width) * bandRows, 0.0f);
+    FractalNoise fractal(_globalNoise);
+
+    float bank = 1.0f - _lakeConfig.riverWidth;
+    for (uint32_t bandY = 0; bandY < chunkSize; bandY += bandRows) {
+        uint32_t height = std::min(bandRows, chunkSize - bandY);
+        fractal.generate(river, origin.first(), origin.second() + static_cast<int>(bandY), width, height,
+                         std::span<float>(ridges.data(), ridges.size()));
+
+        for (uint32_t y = 0; y < height; ++y) {
+            for (size_t c = 0; c < run.size(); ++c) {
+                const float* ridgeRow = ridges.data() + static_cast<size_t>(y) * width + c * chunkSize;
+                Tile* row = run[c]->getRowData(bandY + y);
+                for (uint32_t x = 0; x < chunkSize; ++x) {
+                    if (ridgeRow[x] >= bank) row[x].setHasWater(true);
+                }
             }
         }
     }
@@ -346,17 +663,8 @@ Pair<int, int> WorldGenerator::worldToCellCoords(float worldX, float worldY) con
     );
 }
 
-std::mt19937_64 WorldGenerator::createCellRNG(int cellX, int cellY) const {
-    // Usar el mismo método que calculateCellIndex pero sin convertir a int64_t final
-    uint64_t ux = static_cast<uint64_t>(static_cast<int64_t>(cellX));
-    uint64_t uy = static_cast<uint64_t>(static_cast<int64_t>(cellY));
-    
-    uint64_t encodedX = (ux << 1) ^ (ux >> 63);
-    uint64_t encodedY = (uy << 1) ^ (uy >> 63);
-    
-    uint64_t cellSeed = _worldSeed ^ 
-                       (encodedX << 32) ^ 
-                       (encodedY & 0xFFFFFFFF);
-    return std::mt19937_64(cellSeed);
+CounterRng WorldGenerator::createCellRNG(int cellX, int cellY) const {
+    // Stream 0 de la celda: semillas de bioma. Construirlo no cuesta más que un hash
+    return CounterRng(_worldSeed, cellX, cellY);
 }
 
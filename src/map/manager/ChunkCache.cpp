@@ -0,0 +1,139 @@
+#include <utility>
+
+#include "map/manager/ChunkCache.hpp"
+#include "map/manager/ChunkCodec.hpp"
+
+// ----- Constructores -----
+ChunkCache::ChunkCache(size_t budgetBytes, bool compressed) :
+_budget(budgetBytes),
+_compressed(compressed) {}
+
+// ----- Métodos -----
+void ChunkCache::Put(std::unique_ptr<Chunk>&& chunk, DynamicArray<std::unique_ptr<Chunk>>& evicted) {
+    if (chunk == nullptr) return;
+
+    ChunkCoord coord = chunk->getChunkCoord();
+    if (_entries.find_ptr(coord) != nullptr) {
+        // No debería ocurrir: el chunk estaba cargado, no en caché. Se entrega la copia antigua
+        evicted.push_back(Extract(coord));
+    }
+
+    Entry entry;
+    entry.chunkSize = chunk->getChunkSize();
+    entry.state = chunk->getState();
+    entry.dirty = chunk->isDirty();
+    entry.persisted = chunk->isPersisted();
+
+    if (_compressed) {
+        entry.encoding = ChunkCodec::EncodeSmallest(*chunk, entry.encoded);
+        entry.bytes = sizeof(Entry) + entry.encoded.size();
+    } else {
+        entry.bytes = sizeof(Entry) + ChunkBytes(*chunk);
+        entry.chunk = std::move(chunk);
+    }
+
+    // Un chunk mayor que todo el presupuesto no entra: se devuelve tal cual
+    if (entry.bytes > _budget) {
+        evicted.push_back(entry.chunk != nullptr ? std::move(entry.chunk) : std::move(chunk));
+        return;
+    }
+
+    EvictUntil(_budget - entry.bytes, evicted);
+
+    _recency.push_back(coord);
+    entry.position = _recency.end();
+    --entry.position;
+
+    _used += entry.bytes;
+    _entries.emplace(coord, std::move(entry));
+}
+
+std::unique_ptr<Chunk> ChunkCache::Take(const ChunkCoord& coord) {
+    if (_entries.find_ptr(coord) == nullptr) {
+        ++_misses;
+        return nullptr;
+    }
+
+    ++_hits;
+    return Extract(coord);
+}
+
+void ChunkCache::Clear(DynamicArray<std::unique_ptr<Chunk>>& evicted) {
+    while (!_recency.empty()) {
+        ChunkCoord oldest = _recency.front();
+        evicted.push_back(Extract(oldest));
+    }
+}
+
+void ChunkCache::CopyDirty(DynamicArray<std::unique_ptr<Chunk>>& out) {
+    for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+        Entry& entry = it->second();
+        if (!entry.dirty) continue;
+
+        std::unique_ptr<Chunk> copy;
+        if (entry.chunk != nullptr) {
+            copy = std::make_unique<Chunk>(*entry.chunk);
+            entry.chunk->markPersisted();
+        } else {
+            copy = std::make_unique<Chunk>(it->first(), entry.chunkSize);
+            ChunkCodec::Decode(entry.encoded.data(), entry.encoded.size(), entry.encoding, *copy);
+            copy->setState(entry.state);
+            copy->markDirty();
+        }
+
+        // La copia se guarda; la entrada queda como respaldada en disco
+        entry.dirty = false;
+        entry.persisted = true;
+        out.push_back(std::move(copy));
+    }
+}
+
+// Configuracion
+void ChunkCache::SetBudget(size_t budgetBytes, DynamicArray<std::unique_ptr<Chunk>>& evicted) {
+    _budget = budgetBytes;
+    EvictUntil(_budget, evicted);
+}
+
+void ChunkCache::SetCompressed(bool compressed, DynamicArray<std::unique_ptr<Chunk>>& evicted) {
+    if (compressed == _compressed) return;
+
+    // Las entradas existentes están en la otra forma: se entregan todas
+    Clear(evicted);
+    _compressed = compressed;
+}
+
+size_t ChunkCache::ChunkBytes(const Chunk& chunk) {
+    size_t rows = chunk.getChunkSize();
+    return sizeof(Chunk) + rows * (sizeof(DynamicArray<Tile>) + rows * sizeof(Tile));
+}
+
+// ---------- Metodos privados ----------
+
+std::unique_ptr<Chunk> ChunkCache::Extract(const ChunkCoord& coord) {
+    Entry* entry = _entries.find_ptr(coord);
+
+    std::unique_ptr<Chunk> chunk = std::move(entry->chunk);
+    if (chunk == nullptr) {
+        chunk = std::make_unique<Chunk>(coord, entry->chunkSize);
+        ChunkCodec::Decode(entry->encoded.data(), entry->encoded.size(), entry->encoding, *chunk);
+    }
+
+    // Restaurar el estado tal como estaba al entrar en la caché
+    chunk->setState(entry->state);
+    if (entry->dirty) chunk->markDirty();
+    else if (entry->persisted) chunk->markPersisted();
+    else chunk->markClean();
+
+    _used -= entry->bytes;
+    _recency.erase(entry->position);
+    _entries.erase(coord);
+    return chunk;
+}
+
+void ChunkCache::EvictUntil(size_t budgetBytes, DynamicArray<std::unique_ptr<Chunk>>& evicted) {
+    while (_used > budgetBytes && !_recency.empty()) {
+        ChunkCoord oldest = _recency.front();
+        evicted.push_back(Extract(oldest));
+        ++_evictions;
+    }
+}
@@ -0,0 +1,292 @@
+#include <cstring>
+
+#include "map/manager/ChunkCodec.hpp"
+#include "utils/LZCompressor.hpp"
+
+// ----- Métodos -----
+void ChunkCodec::Encode(const Chunk& chunk, ChunkEncoding encoding, DynamicArray<char>& out) {
+    switch (encoding) {
+        case ChunkEncoding::RAW:
+            EncodeRaw(chunk, out);
+            break;
+
+        case ChunkEncoding::RLE:
+            EncodeRLE(chunk, out);
+            break;
+
+        case ChunkEncoding::RLE_LZ: {
+            DynamicArray<char> rle;
+            EncodeRLE(chunk, rle);
+            CompressRLE(rle, out);
+            break;
+        }
+
+        case ChunkEncoding::DELTA:
+            // Requiere la línea base: ver EncodeDelta
+            EncodeRaw(chunk, out);
+            break;
+    }
+}
+
+ChunkEncoding ChunkCodec::EncodeSmallest(const Chunk& chunk, DynamicArray<char>& out) {
+    size_t rawSize = static_cast<size_t>(chunk.getChunkSize()) * chunk.getChunkSize() * sizeof(Tile);
+
+    DynamicArray<char> rle;
+    EncodeRLE(chunk, rle);
+
+    // Un chunk sin runs (ruido puro) no mejora con RLE: se guarda crudo
+    if (rle.size() >= rawSize) {
+        EncodeRaw(chunk, out);
+        return ChunkEncoding::RAW;
+    }
+
+    DynamicArray<char> compressed;
+    CompressRLE(rle, compressed);
+
+    if (compressed.size() < rle.size()) {
+        out = std::move(compressed);
+        return ChunkEncoding::RLE_LZ;
+    }
+
+    out = std::move(rle);
+    return ChunkEncoding::RLE;
+}
+
+bool ChunkCodec::Decode(const char* data, size_t size, ChunkEncoding encoding, Chunk& chunk) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+
+    switch (encoding) {
+        case ChunkEncoding::RAW:    return DecodeRaw(data, size, chunk);
+        case ChunkEncoding::RLE:    return DecodeRLE(bytes, size, chunk);
+        case ChunkEncoding::RLE_LZ: return DecodeRLE_LZ(bytes, size, chunk);
+        case ChunkEncoding::DELTA:  return DecodeDelta(bytes, size, chunk);
+    }
+    return false;
+}
+
+bool ChunkCodec::EncodeDelta(const Chunk& chunk, const Chunk& baseline, float maxDensity, DynamicArray<char>& out) {
+    uint32_t chunkSize = chunk.getChunkSize();
+    if (baseline.getChunkSize() != chunkSize) return false;
+
+    uint64_t total = static_cast<uint64_t>(chunkSize) * chunkSize;
+    uint64_t maxChanges = static_cast<uint64_t>(static_cast<double>(total) * maxDensity);
+
+    // Primera pasada: contar cambios para descartar pronto los chunks muy editados
+    uint64_t changes = 0;
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        const Tile* row = chunk.getRowData(y);
+        const Tile* base = baseline.getRowData(y);
+        for (uint32_t x = 0; x < chunkSize; ++x) {
+            if (PackTile(row[x]) != PackTile(base[x]) && ++changes > maxChanges) return false;
+        }
+    }
+
+    out.clear();
+    uint64_t hash = HashTiles(baseline);
+    for (size_t i = 0; i < sizeof(hash); ++i) out.push_back(static_cast<char>((hash >> (i * 8)) & 0xFF));
+    WriteVarint(out, changes);
+
+    uint64_t previous = 0;
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        const Tile* row = chunk.getRowData(y);
+        const Tile* base = baseline.getRowData(y);
+        for (uint32_t x = 0; x < chunkSize; ++x) {
+            uint64_t value = PackTile(row[x]);
+            if (value == PackTile(base[x])) continue;
+
+            uint64_t index = static_cast<uint64_t>(y) * chunkSize + x;
+            WriteVarint(out, index - previous);
+            WriteVarint(out, value);
+            previous = index;
+        }
+    }
+    return true;
+}
+
+uint64_t ChunkCodec::HashTiles(const Chunk& chunk) {
+    // FNV-1a sobre los tiles empaquetados (independiente del layout de Tile)
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t y = 0; y < chunk.getChunkSize(); ++y) {
+        const Tile* row = chunk.getRowData(y);
+        for (uint32_t x = 0; x < chunk.getChunkSize(); ++x) {
+            hash ^= PackTile(row[x]);
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+// ---------- Metodos privados ----------
+
+// RAW
+void ChunkCodec::EncodeRaw(const Chunk& chunk, DynamicArray<char>& out) {
+    uint32_t chunkSize = chunk.getChunkSize();
+    size_t rowBytes = static_cast<size_t>(chunkSize) * sizeof(Tile);
+
+    out = DynamicArray<char>(rowBytes * chunkSize);
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        std::memcpy(out.data() + y * rowBytes, static_cast<const void*>(chunk.getRowData(y)), rowBytes);
+    }
+}
+
+bool ChunkCodec::DecodeRaw(const char* data, size_t size, Chunk& chunk) {
+    uint32_t chunkSize = chunk.getChunkSize();
+    size_t rowBytes = static_cast<size_t>(chunkSize) * sizeof(Tile);
+    if (size != rowBytes * chunkSize) return false;
+
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        std::memcpy(static_cast<void*>(chunk.getRowData(y)), data + y * rowBytes, rowBytes);
+    }
+    return true;
+}
+
+// RLE
+void ChunkCodec::EncodeRLE(const Chunk& chunk, DynamicArray<char>& out) {
+    uint32_t chunkSize = chunk.getChunkSize();
+    out.clear();
+
+    bool hasRun = false;
+    uint64_t runValue = 0;
+    uint64_t runLength = 0;
+
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        const Tile* row = chunk.getRowData(y);
+        for (uint32_t x = 0; x < chunkSize; ++x) {
+            uint64_t value = PackTile(row[x]);
+
+            if (hasRun && value == runValue) {
+                ++runLength;
+                continue;
+            }
+
+            if (hasRun) {
+                WriteVarint(out, runLength);
+                WriteVarint(out, runValue);
+            }
+            hasRun = true;
+            runValue = value;
+            runLength = 1;
+        }
+    }
+
+    if (hasRun) {
+        WriteVarint(out, runLength);
+        WriteVarint(out, runValue);
+    }
+}
+
+bool ChunkCodec::DecodeRLE(const uint8_t* data, size_t size, Chunk& chunk) {
+    uint32_t chunkSize = chunk.getChunkSize();
+    uint64_t total = static_cast<uint64_t>(chunkSize) * chunkSize;
+
+    const uint8_t* ip = data;
+    const uint8_t* end = data + size;
+    uint64_t index = 0;
+
+    while (ip < end) {
+        uint64_t runLength = 0;
+        uint64_t value = 0;
+        if (!ReadVarint(ip, end, runLength) || !ReadVarint(ip, end, value)) return false;
+        if (runLength == 0 || runLength > total - index) return false;
+
+        Tile tile = UnpackTile(value);
+        for (uint64_t i = 0; i < runLength; ++i, ++index) {
+            chunk.getRowData(static_cast<uint32_t>(index / chunkSize))[index % chunkSize] = tile;
+        }
+    }
+
+    return index == total;
+}
+
+// RLE + LZ
+void ChunkCodec::CompressRLE(const DynamicArray<char>& rle, DynamicArray<char>& out) {
+    out.clear();
+    out.reserve(rle.size() + rle.size() / 255 + 16);
+
+    WriteVarint(out, rle.size());
+    LZCompressor::compress(reinterpret_cast<const uint8_t*>(rle.data()), rle.size(), out);
+}
+
+bool ChunkCodec::DecodeRLE_LZ(const uint8_t* data, size_t size, Chunk& chunk) {
+    const uint8_t* ip = data;
+    const uint8_t* end = data + size;
+
+    uint64_t rleSize = 0;
+    if (!ReadVarint(ip, end, rleSize)) return false;
+
+    // Cota: cada tile ocupa como mucho dos varints completos en el flujo RLE
+    uint64_t maxRle = static_cast<uint64_t>(chunk.getChunkSize()) * chunk.getChunkSize() * 20;
+    if (rleSize == 0 || rleSize > maxRle) return false;
+
+    DynamicArray<char> rle(static_cast<size_t>(rleSize));
+    if (!LZCompressor::decompress(ip, static_cast<size_t>(end - ip),
+                                  reinterpret_cast<uint8_t*>(rle.data()), rle.size())) {
+        return false;
+    }
+
+    return DecodeRLE(reinterpret_cast<const uint8_t*>(rle.data()), rle.size(), chunk);
+}
+
+// DELTA
+bool ChunkCodec::DecodeDelta(const uint8_t* data, size_t size, Chunk& chunk) {
+    uint64_t hash = 0;
+    if (size < sizeof(hash)) return false;
+    for (size_t i = 0; i < sizeof(hash); ++i) hash |= static_cast<uint64_t>(data[i]) << (i * 8);
+
+    // La línea base debe ser la misma con la que se calcularon las diferencias
+    if (hash != HashTiles(chunk)) return false;
+
+    const uint8_t* ip = data + sizeof(hash);
+    const uint8_t* end = data + size;
+    uint32_t chunkSize = chunk.getChunkSize();
+    uint64_t total = static_cast<uint64_t>(chunkSize) * chunkSize;
+
+    uint64_t changes = 0;
+    if (!ReadVarint(ip, end, changes) || changes > total) return false;
+
+    uint64_t index = 0;
+    for (uint64_t i = 0; i < changes; ++i) {
+        uint64_t skip = 0;
+        uint64_t value = 0;
+        if (!ReadVarint(ip, end, skip) || !ReadVarint(ip, end, value)) return false;
+        if ((i > 0 && skip == 0) || skip >= total - index) return false;
+
+        index += skip;
+        chunk.getRowData(static_cast<uint32_t>(index / chunkSize))[index % chunkSize] = UnpackTile(value);
+    }
+
+    return ip == end;
+}
+
+// Helpers
+uint64_t ChunkCodec::PackTile(const Tile& tile) {
+    // Zigzag del bioma (-1 = sin asignar) y el agua en el bit bajo
+    int64_t biome = tile.getBiomeId();
+    uint64_t zigzag = (static_cast<uint64_t>(biome) << 1) ^ static_cast<uint64_t>(biome >> 63);
+    return (zigzag << 1) | (tile.hasWater() ? 1u : 0u);
+}
+
+Tile ChunkCodec::UnpackTile(uint64_t value) {
+    uint64_t zigzag = value >> 1;
+    int64_t biome = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    return Tile(static_cast<int>(biome), (value & 1) != 0);
+}
+
+void ChunkCodec::WriteVarint(DynamicArray<char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+bool ChunkCodec::ReadVarint(const uint8_t*& ip, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (ip >= end) return false;
+        uint8_t b = *ip++;
+        value |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) return true;
+    }
+    return false;
+}
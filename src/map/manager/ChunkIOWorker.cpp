@@ -0,0 +1,110 @@
+#include <utility>
+
+#include "map/manager/ChunkIOWorker.hpp"
+
+// ----- Constructores -----
+ChunkIOWorker::ChunkIOWorker(ChunkStorage* storage) :
+_storage(storage) {
+    _thread = std::thread(&ChunkIOWorker::Run, this);
+}
+
+// ----- Destructor -----
+ChunkIOWorker::~ChunkIOWorker() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _work_available.notify_all();
+
+    // El hilo vacía la cola antes de terminar
+    if (_thread.joinable()) _thread.join();
+}
+
+// ----- Métodos -----
+void ChunkIOWorker::Enqueue(std::unique_ptr<Chunk>&& chunk) {
+    if (!chunk) return;
+
+    ChunkCoord coord = chunk->getChunkCoord();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Si ya estaba pendiente se sustituye: se escribe la versión más reciente
+        std::unique_ptr<Chunk>* queued = _pending.find_ptr(coord);
+        if (queued != nullptr) {
+            *queued = std::move(chunk);
+        } else {
+            _order.enqueue(coord);
+            _pending.emplace(coord, std::move(chunk));
+        }
+    }
+    _work_available.notify_one();
+}
+
+std::unique_ptr<Chunk> ChunkIOWorker::TakePending(const ChunkCoord& coord) {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Si el chunk se está escribiendo, esperar para no leer un archivo a medias
+    _work_done.wait(lock, [&] { return !_has_inflight || !(_inflight == coord); });
+
+    std::unique_ptr<Chunk>* found = _pending.find_ptr(coord);
+    if (found == nullptr) return nullptr;
+
+    std::unique_ptr<Chunk> chunk = std::move(*found);
+    _pending.erase(coord);      // La entrada de _order queda obsoleta y se ignora
+    return chunk;
+}
+
+bool ChunkIOWorker::IsPending(const ChunkCoord& coord) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending.find_ptr(coord) != nullptr || (_has_inflight && _inflight == coord);
+}
+
+void ChunkIOWorker::Flush() {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _work_done.wait(lock, [&] { return _order.empty() && !_has_inflight; });
+    }
+    _storage->Flush();
+}
+
+size_t ChunkIOWorker::GetPendingCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending.size() + (_has_inflight ? 1 : 0);
+}
+
+size_t ChunkIOWorker::GetWrittenCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _written;
+}
+
+// ---------- Metodos privados ----------
+
+void ChunkIOWorker::Run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true) {
+        _work_available.wait(lock, [&] { return _stop || !_order.empty(); });
+        if (_order.empty()) break;     // _stop y cola vacía
+
+        ChunkCoord coord = _order.extract();
+        std::unique_ptr<Chunk>* found = _pending.find_ptr(coord);
+        if (found == nullptr) {
+            // Recuperado por TakePending antes de escribirse
+            if (_order.empty()) _work_done.notify_all();
+            continue;
+        }
+
+        std::unique_ptr<Chunk> chunk = std::move(*found);
+        _pending.erase(coord);
+        _has_inflight = true;
+        _inflight = coord;
+
+        lock.unlock();
+        _storage->Save(*chunk);
+        chunk.reset();
+        lock.lock();
+
+        _has_inflight = false;
+        ++_written;
+        _work_done.notify_all();
+    }
+}
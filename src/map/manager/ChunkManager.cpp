@@ -3,9 +3,9 @@
 #include <stdexcept>
 #include <utility>
 #include <iostream>
-
-#include <fstream>
-#include <filesystem>
+#include <chrono>
+#include <algorithm>
+#include <cfloat>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -17,31 +17,76 @@
 #include "data_structures/Pair.hpp"
 
 #include "map/manager/ChunkManager.hpp"
-#include "map/manager/ChunkFileFormat.hpp"
 
 // ----- Constructores -----
 
 ChunkManager::ChunkManager(uint32_t chunk_size,
                         uint64_t worldSeed) : 
 _chunk_size(chunk_size),
-_seed(worldSeed) {}
+_seed(worldSeed),
+_storage(std::make_unique<ChunkStorage>(GetDefaultChunkDirectory(), chunk_size, worldSeed)),
+_io_worker(std::make_unique<ChunkIOWorker>(_storage.get())),
+_cache(std::make_unique<ChunkCache>(DEFAULT_CACHE_BUDGET)) {}
 
 ChunkManager::ChunkManager(ChunkManager&& other) noexcept :              
 _chunks(std::move(other._chunks)), 
 _chunk_size(other._chunk_size),
-_seed(other._seed) {
+_seed(other._seed),
+_storage(std::move(other._storage)),
+_io_worker(std::move(other._io_worker)),
+_cache(std::move(other._cache)),
+_persist_policy(other._persist_policy),
+_generation_cost(other._generation_cost),
+_load_cost(other._load_cost),
+_skipped_writes(other._skipped_writes),
+_unload_epoch(other._unload_epoch + 1),
+_residency_listener(std::move(other._residency_listener)),
+_memory_budget(other._memory_budget),
+_resident_bytes(other._resident_bytes),
+_frame(other._frame),
+_budget_evictions(other._budget_evictions),
+_evictions_per_second(other._evictions_per_second) {
+    other._resident_bytes = 0;
+    other._last_chunk = nullptr;
     other._chunk_size = 16;
     other._seed = 12345;
 }
 
+// ----- Destructor -----
+ChunkManager::~ChunkManager() {
+    // Antes de que el hilo de E/S termine de vaciar su cola
+    ClearChunkCache();
+}
+
 // ----- Operadores -----
 ChunkManager& ChunkManager::operator=(ChunkManager&& other) noexcept {    // Operador de asignación por movimiento
     if(this != &other) {
         _chunks.clear();  
+        ClearChunkCache();      // Los chunks modificados en caché se guardan antes de soltarla
         
         _chunk_size = other._chunk_size;
         _chunks = std::move(other._chunks);  // Mover
         _seed = other._seed;
+        _io_worker = std::move(other._io_worker);   // Vacía la cola propia antes de soltar _storage
+        _storage = std::move(other._storage);
+        _cache = std::move(other._cache);
+        _persist_policy = other._persist_policy;
+        _generation_cost = other._generation_cost;
+        _load_cost = other._load_cost;
+        _skipped_writes = other._skipped_writes;
+        _last_chunk = nullptr;
+        _unload_epoch = std::max(_unload_epoch, other._unload_epoch) + 1;
+        _residency_listener = std::move(other._residency_listener);
+        _memory_budget = other._memory_budget;
+        _resident_bytes = other._resident_bytes;
+        _frame = other._frame;
+        _budget_evictions = other._budget_evictions;
+        _evictions_per_second = other._evictions_per_second;
+        _eviction_queue.clear();
+        _eviction_cursor = 0;
+
+        other._resident_bytes = 0;
+        other._last_chunk = nullptr;
 
         other._chunk_size = 16;
         other._seed = 12345;
@@ -64,6 +109,10 @@ ChunkCoord ChunkManager::WorldToChunkPos(int worldX, int worldY) const {
 Chunk* ChunkManager::SetChunk(ChunkCoord coord, std::unique_ptr<Chunk>&& chunk){   
     Chunk* raw = _chunks.emplace(coord,std::move(chunk)).get();
     LinkChunkNeighbors(raw);
+    if (_residency_listener) _residency_listener(coord, true);
+
+    _resident_bytes += ChunkCache::ChunkBytes(*raw);
+    raw->touch(_frame);
 
     return raw;
 }
@@ -76,6 +125,10 @@ Chunk* ChunkManager::SetChunk(int worldX, int worldY, std::unique_ptr<Chunk>&& c
 const Chunk* ChunkManager::Read_SetChunk(ChunkCoord coord, std::unique_ptr<Chunk>&& chunk){   
     Chunk* raw = _chunks.emplace(coord,std::move(chunk)).get();
     LinkChunkNeighbors(raw);
+    if (_residency_listener) _residency_listener(coord, true);
+
+    _resident_bytes += ChunkCache::ChunkBytes(*raw);
+    raw->touch(_frame);
 
     return raw;
 }
@@ -86,11 +139,38 @@ const Chunk* ChunkManager::Read_SetChunk(int worldX, int worldY, std::unique_ptr
 }
 
 Chunk* ChunkManager::GetChunk(ChunkCoord coord) {
+    if (_last_chunk != nullptr && _last_coord == coord) {
+        _last_chunk->touch(_frame);
+        return _last_chunk;
+    }
+
     std::unique_ptr<Chunk>* found_chunk = _chunks.find_ptr(coord);
-    if (found_chunk != nullptr) return found_chunk->get();
+    if (found_chunk != nullptr) {
+        (*found_chunk)->touch(_frame);
+        _last_chunk = found_chunk->get();
+        _last_coord = coord;
+        return _last_chunk;
+    }
+
+    // Descargado hace poco: se recupera sin E/S ni generación
+    if (_cache) {
+        std::unique_ptr<Chunk> cached_chunk = _cache->Take(coord);
+        if (cached_chunk != nullptr) return SetChunk(coord, std::move(cached_chunk));
+    }
+
+    // Chunk descargado cuya escritura aún está en cola
+    if (_io_worker) {
+        std::unique_ptr<Chunk> pending_chunk = _io_worker->TakePending(coord);
+        if (pending_chunk != nullptr) return SetChunk(coord, std::move(pending_chunk));
+    }
         
+    auto start = std::chrono::steady_clock::now();
     std::unique_ptr<Chunk> disk_chunk = LoadChunkFromDisk(coord);
     if (disk_chunk != nullptr) {
+        UpdateAverage(_load_cost, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        // Los vecinos de un chunk recién cargado suelen ser los siguientes en pedirse
+        PrefetchNeighbors(coord);
         return SetChunk(coord, std::move(disk_chunk));
     }
 
@@ -102,6 +182,11 @@ Chunk* ChunkManager::GetChunk(int worldX, int worldY) {
     return GetChunk(chunkPos);
 }
 
+Chunk* ChunkManager::FindChunk(const ChunkCoord& coord) {
+    std::unique_ptr<Chunk>* found_chunk = _chunks.find_ptr(coord);
+    return (found_chunk != nullptr) ? found_chunk->get() : nullptr;
+}
+
 const Chunk* ChunkManager::GetChunk(ChunkCoord coord) const{
     const std::unique_ptr<Chunk>* found_chunk = _chunks.find_ptr(coord);
     if (found_chunk != nullptr) return found_chunk->get();
@@ -141,16 +226,87 @@ const Tile& ChunkManager::GetTile(int worldX, int worldY) const {
     return GetTile(worldX, worldY, chunk);
 }
 
+// Regiones rectangulares
+size_t ChunkManager::ReadRegion(const TileRect& rect, std::span<Tile> out) {
+    if (out.size() < rect.area()) throw std::invalid_argument("ReadRegion: output span smaller than rect");
+
+    return ForEachRegionSpan(rect,
+        [this](const ChunkCoord& coord) { return GetChunk(coord); },
+        [&out](Chunk* chunk, int localX, int localY, size_t length, size_t offset) {
+            // Lectura por la vista const: no debe marcar el chunk como modificado
+            const Tile* row = static_cast<const Chunk*>(chunk)->getRowData(static_cast<uint32_t>(localY));
+            std::copy(row + localX, row + localX + length, out.data() + offset);
+        });
+}
+
+size_t ChunkManager::ReadRegion(const TileRect& rect, std::span<Tile> out) const {
+    if (out.size() < rect.area()) throw std::invalid_argument("ReadRegion: output span smaller than rect");
+
+    return ForEachRegionSpan(rect,
+        [this](const ChunkCoord& coord) { return GetChunk(coord); },
+        [&out](const Chunk* chunk, int localX, int localY, size_t length, size_t offset) {
+            const Tile* row = chunk->getRowData(static_cast<uint32_t>(localY));
+            std::copy(row + localX, row + localX + length, out.data() + offset);
+        });
+}
+
+size_t ChunkManager::WriteRegion(const TileRect& rect, std::span<const Tile> in) {
+    if (in.size() < rect.area()) throw std::invalid_argument("WriteRegion: input span smaller than rect");
+
+    return ForEachRegionSpan(rect,
+        [this](const ChunkCoord& coord) { return GetChunk(coord); },
+        [&in](Chunk* chunk, int localX, int localY, size_t length, size_t offset) {
+            Tile* row = chunk->getRowData(static_cast<uint32_t>(localY));     // Marca el chunk como modificado
+            std::copy(in.data() + offset, in.data() + offset + length, row + localX);
+        });
+}
+
+void ChunkManager::GetRegionChunks(const TileRect& rect, DynamicArray<ChunkCoord>& out) const {
+    if (rect.empty()) return;
+
+    ChunkCoord first = WorldToChunkPos(rect.x, rect.y);
+    ChunkCoord last = WorldToChunkPos(rect.x + static_cast<int>(rect.width) - 1,
+                                      rect.y + static_cast<int>(rect.height) - 1);
+
+    for (int chunkY = first.y(); chunkY <= last.y(); ++chunkY) {
+        for (int chunkX = first.x(); chunkX <= last.x(); ++chunkX) out.push_back(ChunkCoord(chunkX, chunkY));
+    }
+}
+
+void ChunkManager::PrefetchRegion(const TileRect& rect) {
+    if (!_storage) return;
+
+    DynamicArray<ChunkCoord> coords;
+    GetRegionChunks(rect, coords);
+    for (const ChunkCoord& coord : coords) {
+        if (_chunks.find_ptr(coord) == nullptr) _storage->Prefetch(coord);
+    }
+}
+
 // Eliminacion/descarga
 void ChunkManager::eraseChunk(const ChunkCoord& coord){
-    Chunk* chunk = GetChunk(coord);
-    if (chunk != nullptr) {
-        SaveChunkToDisk(chunk);
-        UnlinkChunkNeighbors(coord, chunk);
-    }
+    std::unique_ptr<Chunk>* found_chunk = _chunks.find_ptr(coord);
+    if (found_chunk == nullptr) return;
+
+    std::unique_ptr<Chunk> chunk = std::move(*found_chunk);
+    UnlinkChunkNeighbors(coord, chunk.get());
+
+    if (_last_chunk == chunk.get()) _last_chunk = nullptr;
+    ++_unload_epoch;
+    _resident_bytes -= ChunkCache::ChunkBytes(*chunk);
 
     // Usa el método erase() correcto de Unordered_map
     _chunks.erase(coord);
+    if (_residency_listener) _residency_listener(coord, false);
+
+    // Primero a la caché; lo que expulse se guarda o se descarta
+    if (_cache) {
+        DynamicArray<std::unique_ptr<Chunk>> evicted;
+        _cache->Put(std::move(chunk), evicted);
+        RetireChunks(evicted);
+    } else {
+        RetireChunk(std::move(chunk));
+    }
 }
   
 // Utilidades
@@ -159,88 +315,134 @@ bool ChunkManager::HasChunk(int worldX, int worldY) const {
     return _chunks.find_ptr(chunkPos) != nullptr;
 }
 
-// ---------- Metodos privados ----------
+// Almacenamiento
+void ChunkManager::SetStorageFormat(StorageFormat format) {
+    if (_io_worker) _io_worker->Flush();
+    if (_storage) _storage->SetFormat(format);
+}
 
-// Disk - Chunks
-std::unique_ptr<Chunk> ChunkManager::LoadChunkFromDisk(const ChunkCoord& coord) {
-    // Generar nombre de archivo
-    std::string filename = GetChunkDirectory() + "/chunk_" + 
-                        std::to_string(coord.x()) + "_" + 
-                        std::to_string(coord.y()) + ".chnk";
-    
-    // Verificar si el archivo existe
-    if (!std::filesystem::exists(filename)) {
-        return nullptr;
-    }
+StorageFormat ChunkManager::GetStorageFormat() const {
+    return _storage ? _storage->GetFormat() : StorageFormat::REGION;
+}
 
-    std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
-        std::cout << "ERROR: No se pudo abrir archivo para cargar: " << filename << "\n";
-        return nullptr;
-    }
-    
-    // Leer header
-    ChunkFileHeader header;
-    file.read(reinterpret_cast<char*>(&header), sizeof(ChunkFileHeader));
-    
-    // Verificar magic number
-    if (header.magic[0] != 'C' || header.magic[1] != 'H' || 
-        header.magic[2] != 'N' || header.magic[3] != 'K') {
-        std::cout << "ERROR: Archivo corrupto o formato inválido: " << filename << "\n";
-        return nullptr;
-    }
-    
-    // Verificar versión
-    if (header.version != 1) {
-        std::cout << "ERROR: Versión de formato no soportada: " << header.version << "\n";
-        return nullptr;
-    }
+void ChunkManager::SetMappedReads(bool enabled) {
+    if (_storage) _storage->SetMappedReads(enabled);
+}
 
-    // Verificar coordenadas
-    if (header.chunkX != coord.x() || header.chunkY != coord.y()) {
-        std::cout << "ERROR: Coordenadas en archivo no coinciden: " 
-                << "esperado (" << coord.x() << ", " << coord.y() << "), "
-                << "encontrado (" << header.chunkX << ", " << header.chunkY << ")\n";
-        return nullptr;
-    }
+void ChunkManager::SetCompression(bool enabled) {
+    // El hilo de E/S serializa con este ajuste: vaciar la cola antes de cambiarlo
+    if (_io_worker) _io_worker->Flush();
+    if (_storage) _storage->SetCompression(enabled);
+}
+
+void ChunkManager::SetBaselineProvider(BaselineProvider provider) {
+    if (_io_worker) _io_worker->Flush();
+    if (_storage) _storage->SetBaselineProvider(std::move(provider));
+}
+
+void ChunkManager::SetDeltaThreshold(float threshold) {
+    if (_io_worker) _io_worker->Flush();
+    if (_storage) _storage->SetDeltaThreshold(threshold);
+}
+
+void ChunkManager::SetGeneratorVersion(uint32_t version) {
+    if (_io_worker) _io_worker->Flush();
+    if (_storage) _storage->SetGeneratorVersion(version);
+}
+
+void ChunkManager::SetChunkDirectory(const std::string& directory) {
+    ClearChunkCache();      // Los chunks en caché pertenecen al directorio anterior
+    if (_io_worker) _io_worker->Flush();
+    if (_storage) _storage->SetDirectory(directory);
+}
+
+std::string ChunkManager::GetChunkDirectory() const {
+    return _storage ? _storage->GetDirectory() : GetDefaultChunkDirectory();
+}
 
-    // Verificar que el tamaño del chunk coincide
-    if (header.chunkSize != _chunk_size) {
-        std::cout << "WARNING: Tamaño de chunk no coincide: " 
-                << header.chunkSize << " vs " << _chunk_size << "\n";
-        return nullptr;
+void ChunkManager::FlushStorage() {
+    // Los chunks modificados que siguen en caché también se escriben
+    if (_cache) {
+        DynamicArray<std::unique_ptr<Chunk>> dirty;
+        _cache->CopyDirty(dirty);
+        RetireChunks(dirty);
     }
 
-    // Verificar que la Seed del mundo sea correcta
-    if (header.seed != _seed) {
-        std::cout << "WARNING: La seed del mundo no coincide: " 
-                << header.seed << " vs " << _seed << "\n";
-        return nullptr;
+    if (_io_worker) _io_worker->Flush();
+    else if (_storage) _storage->Flush();
+}
+
+size_t ChunkManager::GetPendingWriteCount() const {
+    return _io_worker ? _io_worker->GetPendingCount() : 0;
+}
+
+// Presupuesto de memoria
+size_t ChunkManager::EnforceMemoryBudget(const DynamicArray<ChunkCoord>& centers, double timeBudgetSeconds,
+                                         DynamicArray<ChunkCoord>* evictedOut) {
+    ++_frame;
+
+    if (_memory_budget == 0 || _resident_bytes <= _memory_budget) {
+        _eviction_queue.clear();
+        _eviction_cursor = 0;
+        UpdateEvictionRate(0);
+        return 0;
     }
 
-    // Crear chunk
-    auto chunk = std::make_unique<Chunk>(coord, header.chunkSize);
-    
-    // Leer datos de tiles
-    for (uint32_t y = 0; y < header.chunkSize; ++y) {
-        for (uint32_t x = 0; x < header.chunkSize; ++x) {
-            Tile tile;
-            file.read(reinterpret_cast<char*>(&tile), sizeof(Tile));
-            
-            if (!file.good()) {
-                std::cout << "ERROR: Fallo al leer tile en (" << x << ", " << y << ")\n";
-                return nullptr;
-            }
-            
-            chunk->at(x, y) = tile;
+    // Las prioridades cambian con los centros y los accesos: la cola caduca
+    const uint64_t queueLifetime = 30;
+    if (_frame - _eviction_queue_frame > queueLifetime) _eviction_cursor = _eviction_queue.size();
+
+    auto start = std::chrono::steady_clock::now();
+    size_t evicted = 0;
+
+    while (_resident_bytes > _memory_budget) {
+        if (_eviction_cursor >= _eviction_queue.size()) {
+            BuildEvictionQueue(centers);
+            if (_eviction_queue.empty()) break;
         }
+
+        ChunkCoord coord = _eviction_queue[_eviction_cursor++].coord;
+        if (_chunks.find_ptr(coord) == nullptr) continue;     // Ya descargado
+
+        eraseChunk(coord);
+        if (evictedOut) evictedOut->push_back(coord);
+        ++evicted;
+
+        // Al menos una expulsión por llamada para garantizar progreso
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= timeBudgetSeconds) break;
     }
-    chunk->setState(State::LOADED);
 
-    file.close();
-    
-    return chunk;
+    UpdateEvictionRate(evicted);
+    return evicted;
+}
+
+// Cache de chunks descargados
+void ChunkManager::SetChunkCacheBudget(size_t budgetBytes) {
+    if (!_cache) return;
+    DynamicArray<std::unique_ptr<Chunk>> evicted;
+    _cache->SetBudget(budgetBytes, evicted);
+    RetireChunks(evicted);
+}
 
+void ChunkManager::SetChunkCacheCompressed(bool compressed) {
+    if (!_cache) return;
+    DynamicArray<std::unique_ptr<Chunk>> evicted;
+    _cache->SetCompressed(compressed, evicted);
+    RetireChunks(evicted);
+}
+
+// Persistencia de chunks sin modificar
+void ChunkManager::RecordGenerationTime(double seconds) {
+    UpdateAverage(_generation_cost, seconds);
+}
+
+// ---------- Metodos privados ----------
+
+// Disk - Chunks
+std::unique_ptr<Chunk> ChunkManager::LoadChunkFromDisk(const ChunkCoord& coord) {
+    if (!_storage) return nullptr;
+    return _storage->Load(coord);
 }
 
 void ChunkManager::SaveChunkToDisk(Chunk* chunk){
@@ -248,49 +450,146 @@ void ChunkManager::SaveChunkToDisk(Chunk* chunk){
         std::cout << "ERROR: Intento de guardar chunk nulo\n";
         return;
     }
-    
-    std::string chunkDir = GetChunkDirectory();
-    std::filesystem::create_directories(chunkDir);
+    if (!_storage) return;
 
-    // Generar nombre de archivo
-    std::string filename = chunkDir + "/chunk_" + 
-        std::to_string(chunk->getChunkX()) + "_" + 
-        std::to_string(chunk->getChunkY()) + ".chnk";
+    _storage->Save(*chunk);
+}
 
-    std::ofstream file(filename, std::ios::binary);
-    
-    if (!file.is_open()) {
-        std::cout << "ERROR: No se pudo abrir archivo para guardar: " << filename << "\n";
-        return;
-    } 
+void ChunkManager::PrefetchNeighbors(const ChunkCoord& coord) {
+    if (!_storage) return;
 
-    ChunkFileHeader header;
-    header.chunkX = chunk->getChunkX();
-    header.chunkY = chunk->getChunkY();
-    header.chunkSize = chunk->getChunkSize();
-    header.state = chunk->getState();
-    header.seed = _seed;
+    const ChunkCoord neighbors[4] = {coord.get_North(), coord.get_South(), coord.get_East(), coord.get_West()};
+    for (const ChunkCoord& neighbor : neighbors) {
+        if (_chunks.find_ptr(neighbor) == nullptr) _storage->Prefetch(neighbor);
+    }
+}
 
-    // Calcular tamaño de datos (asumiendo que cada Tile tiene tamaño fijo)
-    header.tileDataSize = header.chunkSize * header.chunkSize * sizeof(Tile);
-    
-    // Escribir header
-    file.write(reinterpret_cast<const char*>(&header), sizeof(ChunkFileHeader));
-    
-    // Escribir datos de tiles
-    for (uint32_t y = 0; y < chunk->getChunkSize(); ++y) {
-        for (uint32_t x = 0; x < chunk->getChunkSize(); ++x) {
-            const Tile& tile = chunk->at(x, y);
-            file.write(reinterpret_cast<const char*>(&tile), sizeof(Tile));
+template <typename Resolve, typename Visit>
+size_t ChunkManager::ForEachRegionSpan(const TileRect& rect, Resolve&& resolve, Visit&& visit) const {
+    if (rect.empty()) return 0;
+
+    const int size = static_cast<int>(_chunk_size);
+    const int endX = rect.x + static_cast<int>(rect.width);     // Exclusivos
+    const int endY = rect.y + static_cast<int>(rect.height);
+
+    ChunkCoord first = WorldToChunkPos(rect.x, rect.y);
+    ChunkCoord last = WorldToChunkPos(endX - 1, endY - 1);
+
+    size_t copied = 0;
+    for (int chunkY = first.y(); chunkY <= last.y(); ++chunkY) {
+        for (int chunkX = first.x(); chunkX <= last.x(); ++chunkX) {
+            auto chunk = resolve(ChunkCoord(chunkX, chunkY));
+            if (chunk == nullptr) continue;
+
+            // Intersección del chunk con rect
+            int originX = chunkX * size;
+            int originY = chunkY * size;
+            int x0 = std::max(rect.x, originX);
+            int y0 = std::max(rect.y, originY);
+            int x1 = std::min(endX, originX + size);
+            int y1 = std::min(endY, originY + size);
+
+            size_t length = static_cast<size_t>(x1 - x0);
+            for (int worldY = y0; worldY < y1; ++worldY) {
+                size_t offset = static_cast<size_t>(worldY - rect.y) * rect.width + static_cast<size_t>(x0 - rect.x);
+                visit(chunk, x0 - originX, worldY - originY, length, offset);
+            }
+            copied += length * static_cast<size_t>(y1 - y0);
         }
     }
-    
-    if (!file.good()) {
-        std::cout << "ERROR: Fallo al escribir chunk: " << filename << "\n";
+
+    return copied;
+}
+
+bool ChunkManager::ShouldPersist(const Chunk& chunk) const {
+    if (chunk.isDirty()) return true;
+    if (chunk.isPersisted()) return false;      // El disco ya tiene este contenido
+
+    // Chunk limpio recién generado
+    switch (_persist_policy) {
+        case PersistPolicy::ALWAYS:     return true;
+        case PersistPolicy::DIRTY_ONLY: return false;
+        case PersistPolicy::ADAPTIVE:
+            // Sin medidas de carga aún no hay con qué comparar: regenerar
+            return _load_cost > 0.0 && _generation_cost > _load_cost;
+    }
+    return true;
+}
+
+void ChunkManager::RetireChunk(std::unique_ptr<Chunk>&& chunk) {
+    if (chunk == nullptr) return;
+
+    // Sin cambios respecto al disco o a la seed: se descarta y se vuelve a cargar o generar
+    if (!ShouldPersist(*chunk)) {
+        ++_skipped_writes;
         return;
     }
-    
-    file.close();
+
+    // La escritura se hace en el hilo de E/S; el chunk se entrega por movimiento
+    if (_io_worker) _io_worker->Enqueue(std::move(chunk));
+    else SaveChunkToDisk(chunk.get());
+}
+
+void ChunkManager::RetireChunks(DynamicArray<std::unique_ptr<Chunk>>& chunks) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        RetireChunk(std::move(chunks[i]));
+    }
+    chunks.clear();
+}
+
+void ChunkManager::ClearChunkCache() {
+    if (!_cache) return;
+    DynamicArray<std::unique_ptr<Chunk>> evicted;
+    _cache->Clear(evicted);
+    RetireChunks(evicted);
+}
+
+void ChunkManager::BuildEvictionQueue(const DynamicArray<ChunkCoord>& centers) {
+    _eviction_queue.clear();
+    _eviction_cursor = 0;
+    _eviction_queue_frame = _frame;
+
+    for (auto it = _chunks.begin(); it != _chunks.end(); ++it) {
+        _eviction_queue.push_back(EvictionCandidate{EvictionScore(*it->second(), centers), it->first()});
+    }
+
+    std::sort(_eviction_queue.data(), _eviction_queue.data() + _eviction_queue.size(),
+              [](const EvictionCandidate& a, const EvictionCandidate& b) { return a.score > b.score; });
+}
+
+float ChunkManager::EvictionScore(const Chunk& chunk, const DynamicArray<ChunkCoord>& centers) const {
+    // Distancia (en chunks) al centro de actividad más cercano
+    float distance = centers.empty() ? 0.0f : FLT_MAX;
+    for (size_t i = 0; i < centers.size(); ++i) {
+        distance = std::min(distance, centers[i].euclideanDistance(chunk.getChunkCoord()));
+    }
+
+    // Antigüedad del último acceso, ~1 punto por segundo a 60 fps
+    float age = static_cast<float>(_frame - chunk.getLastAccess()) / 60.0f;
+
+    float score = distance + age;
+
+    // Expulsar un chunk modificado cuesta una escritura: se prefieren los limpios
+    if (chunk.isDirty()) score *= 0.5f;
+    return score;
+}
+
+void ChunkManager::UpdateEvictionRate(size_t evicted) {
+    _budget_evictions += evicted;
+    _window_evictions += evicted;
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - _window_start).count();
+    if (elapsed >= 1.0) {
+        _evictions_per_second = static_cast<double>(_window_evictions) / elapsed;
+        _window_evictions = 0;
+        _window_start = now;
+    }
+}
+
+void ChunkManager::UpdateAverage(double& average, double sample) {
+    // Media móvil exponencial; la primera muestra la inicializa
+    average = (average == 0.0) ? sample : average * 0.9 + sample * 0.1;
 }
 
 // Dynamic Link - Chunks
@@ -400,9 +699,10 @@ std::string ChunkManager::GetExecutableDirectory() const {
     #endif
 }
 
-std::string ChunkManager::GetChunkDirectory() const {
-    std::string exeDir = GetExecutableDirectory();
-    return exeDir + "/world/chunks";
+std::string ChunkManager::GetDefaultChunkDirectory() const {
+    // El ejecutable no cambia de sitio: resolver la ruta una sola vez
+    static const std::string directory = GetExecutableDirectory() + "/world/chunks";
+    return directory;
 }
 
 // Iteradores - Metodos
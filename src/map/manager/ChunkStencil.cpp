@@ -0,0 +1,127 @@
+#include <stdexcept>
+#include <algorithm>
+
+#include "map/manager/ChunkStencil.hpp"
+#include "map/manager/ChunkManager.hpp"
+
+// ----- Métodos -----
+void ChunkStencil::Build(const Chunk& center, uint32_t halo) {
+    int size = static_cast<int>(center.getChunkSize());
+    int h = static_cast<int>(halo);
+    if (h > size) throw std::invalid_argument("ChunkStencil: halo larger than chunk size");
+
+    if (size != _chunk_size || h != _halo) {
+        _chunk_size = size;
+        _halo = h;
+        _stride = size + 2 * h;
+        _tiles = DynamicArray<Tile>(static_cast<size_t>(_stride) * _stride, Tile());
+    }
+
+    _missing_neighbors = 0;
+    CopyBlock(center, 0, 0, 0, 0, size, size);
+    if (h == 0) return;
+
+    // Para cada eje: -1 = halo bajo, 0 = interior, 1 = halo alto
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            if (dx == 0 && dy == 0) continue;
+
+            int dstX = (dx < 0) ? -h : (dx == 0 ? 0 : size);
+            int dstY = (dy < 0) ? -h : (dy == 0 ? 0 : size);
+            int width = (dx == 0) ? size : h;
+            int height = (dy == 0) ? size : h;
+
+            const Chunk* neighbor = Neighbor(center, dx, dy);
+            if (neighbor == nullptr) {
+                ++_missing_neighbors;
+                ClampBlock(dstX, dstY, width, height);
+                continue;
+            }
+
+            // En el vecino, el halo bajo son sus últimas filas/columnas y el alto las primeras
+            int srcX = (dx < 0) ? size - h : 0;
+            int srcY = (dy < 0) ? size - h : 0;
+            CopyBlock(*neighbor, srcX, srcY, dstX, dstY, width, height);
+        }
+    }
+}
+
+// ---------- Metodos privados ----------
+
+void ChunkStencil::CopyBlock(const Chunk& source, int srcX, int srcY, int dstX, int dstY, int width, int height) {
+    for (int y = 0; y < height; ++y) {
+        const Tile* src = source.getRowData(static_cast<uint32_t>(srcY + y)) + srcX;
+        std::copy(src, src + width, mutableRow(dstY + y) + dstX);
+    }
+}
+
+void ChunkStencil::ClampBlock(int dstX, int dstY, int width, int height) {
+    // El chunk central ya está copiado: se replica su tile de borde más cercano
+    for (int y = dstY; y < dstY + height; ++y) {
+        const Tile* src = row(std::clamp(y, 0, _chunk_size - 1));
+        Tile* dst = mutableRow(y);
+        for (int x = dstX; x < dstX + width; ++x) dst[x] = src[std::clamp(x, 0, _chunk_size - 1)];
+    }
+}
+
+const Chunk* ChunkStencil::Neighbor(const Chunk& center, int dx, int dy) {
+    if (dx == 0 || dy == 0) return center.getNeighborChunk(dx, dy);
+
+    // Diagonales: dos saltos, probando ambos caminos por si falta un vecino intermedio
+    const Chunk* horizontal = center.getNeighborChunk(dx, 0);
+    if (horizontal != nullptr && horizontal->getNeighborChunk(0, dy) != nullptr) return horizontal->getNeighborChunk(0, dy);
+
+    const Chunk* vertical = center.getNeighborChunk(0, dy);
+    if (vertical != nullptr) return vertical->getNeighborChunk(dx, 0);
+
+    return nullptr;
+}
+
+// ----- Métodos -----
+size_t StencilDriver::Run(ChunkManager& manager, uint32_t halo, const StencilKernel& kernel) {
+    _changed_tiles = 0;
+    _targets.clear();
+
+    for (auto it = manager.begin(); it != manager.end(); ++it) {
+        if ((*it)->getState() == State::ACTIVE) _targets.push_back(*it);
+    }
+    if (_targets.empty()) return 0;
+
+    size_t area = static_cast<size_t>(manager.getChunkSize()) * manager.getChunkSize();
+    if (_back.size() < _targets.size() * area) _back = DynamicArray<Tile>(_targets.size() * area, Tile());
+
+    // Fase de lectura: todos los kernels ven el estado anterior
+    for (size_t i = 0; i < _targets.size(); ++i) {
+        _stencil.Build(*_targets[i], halo);
+        kernel(_stencil, std::span<Tile>(_back.data() + i * area, area));
+    }
+
+    // Fase de escritura
+    for (size_t i = 0; i < _targets.size(); ++i) {
+        _changed_tiles += Commit(*_targets[i], _back.data() + i * area);
+    }
+
+    return _targets.size();
+}
+
+// ---------- Metodos privados ----------
+
+size_t StencilDriver::Commit(Chunk& chunk, const Tile* result) {
+    uint32_t size = chunk.getChunkSize();
+    const Chunk& current = chunk;
+    size_t changed = 0;
+
+    for (uint32_t y = 0; y < size; ++y) {
+        const Tile* source = result + static_cast<size_t>(y) * size;
+        const Tile* row = current.getRowData(y);
+
+        size_t rowChanged = 0;
+        for (uint32_t x = 0; x < size; ++x) rowChanged += (source[x] != row[x]);
+        if (rowChanged == 0) continue;      // Filas iguales no marcan el chunk como modificado
+
+        std::copy(source, source + size, chunk.getRowData(y));
+        changed += rowChanged;
+    }
+
+    return changed;
+}
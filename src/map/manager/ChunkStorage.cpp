@@ -0,0 +1,503 @@
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+
+#include "map/manager/ChunkStorage.hpp"
+#include "map/manager/ChunkFileFormat.hpp"
+#include "map/manager/ChunkCodec.hpp"
+#include "map/manager/MappedFile.hpp"
+
+// ----- Constructores -----
+ChunkStorage::ChunkStorage(const std::string& directory,
+                           uint32_t chunk_size,
+                           uint64_t worldSeed,
+                           StorageFormat format) :
+_directory(directory),
+_chunk_size(chunk_size),
+_seed(worldSeed),
+_format(format),
+_regions(directory) {}
+
+// ----- Destructor -----
+ChunkStorage::~ChunkStorage() {
+    Flush();
+}
+
+// ----- Métodos -----
+// Disco
+std::unique_ptr<Chunk> ChunkStorage::Load(const ChunkCoord& coord) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    EnsureIndex();
+
+    // Nunca guardado: no hay nada que buscar en disco
+    StorageFormat* stored = _index.find_ptr(coord);
+    if (stored == nullptr) return nullptr;
+
+    uint32_t version = _generator_version;
+    std::unique_ptr<Chunk> chunk = (*stored == StorageFormat::REGION) ? LoadFromRegion(coord, version) : LoadFromFile(coord, version);
+
+    if (version != _generator_version) {
+        if (!_generator_warned) {
+            std::cout << "WARNING: Chunks guardados con la versión " << version << " del generador (actual "
+                    << _generator_version << "): los chunks no guardados se regeneran y pueden no encajar\n";
+            _generator_warned = true;
+        }
+
+        // No se puede reconstruir: se conserva en disco sin sobrescribirlo con uno regenerado
+        if (chunk == nullptr) {
+            _incompatible[coord] = version;
+            return nullptr;
+        }
+    }
+
+    // Borrado o dañado fuera de la aplicación: no volver a intentarlo
+    if (chunk == nullptr) _index.erase(coord);
+    return chunk;
+}
+
+bool ChunkStorage::Save(const Chunk& chunk) {
+    DynamicArray<char> payload;
+    SerializeChunk(chunk, payload);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    EnsureIndex();
+
+    // Sustituiría ediciones guardadas frente a la línea base de otra versión del generador
+    ChunkCoord coord = chunk.getChunkCoord();
+    uint32_t* incompatible = _incompatible.find_ptr(coord);
+    if (incompatible != nullptr) {
+        std::cout << "ERROR: No se sobrescribe el chunk (" << coord.x() << ", " << coord.y()
+                << ") guardado con la versión " << *incompatible << " del generador\n";
+        return false;
+    }
+
+    bool saved = (_format == StorageFormat::REGION) ? SaveToRegion(chunk, payload) : SaveToFile(chunk, payload);
+    if (!saved) return false;
+
+    // Quitar la copia en el otro formato para que el índice tenga un único origen
+    StorageFormat* stored = _index.find_ptr(coord);
+    if (stored != nullptr && *stored != _format) {
+        if (*stored == StorageFormat::REGION) {
+            RegionFile* region = _regions.Get(RegionFile::ChunkToRegion(coord), false);
+            if (region != nullptr) region->EraseChunk(coord);
+        } else {
+            std::error_code error;
+            std::filesystem::remove(GetChunkFilePath(coord), error);
+        }
+    }
+
+    _index[coord] = _format;
+    return true;
+}
+
+bool ChunkStorage::Erase(const ChunkCoord& coord) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    EnsureIndex();
+
+    StorageFormat* stored = _index.find_ptr(coord);
+    if (stored == nullptr) return false;
+
+    bool erased = false;
+    if (*stored == StorageFormat::REGION) {
+        RegionFile* region = _regions.Get(RegionFile::ChunkToRegion(coord), false);
+        erased = region != nullptr && region->EraseChunk(coord);
+    } else {
+        std::error_code error;
+        erased = std::filesystem::remove(GetChunkFilePath(coord), error);
+    }
+
+    _index.erase(coord);
+    _incompatible.erase(coord);
+    return erased;
+}
+
+void ChunkStorage::Flush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _regions.FlushAll();
+}
+
+// Índice de presencia
+bool ChunkStorage::Contains(const ChunkCoord& coord) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    EnsureIndex();
+    return _index.find_ptr(coord) != nullptr;
+}
+
+size_t ChunkStorage::GetStoredCount() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    EnsureIndex();
+    return _index.size();
+}
+
+size_t ChunkStorage::GetIncompatibleCount() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _incompatible.size();
+}
+
+void ChunkStorage::RebuildIndex() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _regions.FlushAll();
+    _incompatible.clear();
+    _index_built = false;
+    EnsureIndex();
+}
+
+void ChunkStorage::Prefetch(const ChunkCoord& coord) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_mapped_reads) return;
+
+    EnsureIndex();
+    StorageFormat* stored = _index.find_ptr(coord);
+    if (stored == nullptr || *stored != StorageFormat::REGION) return;
+
+    RegionFile* region = _regions.Get(RegionFile::ChunkToRegion(coord), false);
+    if (region != nullptr) region->Prefetch(coord);
+}
+
+// Serializacion
+void ChunkStorage::SerializeChunk(const Chunk& chunk, DynamicArray<char>& out) const {
+    ChunkFileHeader header;
+    header.chunkX = chunk.getChunkX();
+    header.chunkY = chunk.getChunkY();
+    header.chunkSize = chunk.getChunkSize();
+    header.state = chunk.getState();
+    header.seed = _seed;
+
+    // Tamaño de los tiles sin codificar (asumiendo que cada Tile tiene tamaño fijo)
+    header.tileDataSize = header.chunkSize * header.chunkSize * sizeof(Tile);
+
+    if (!_compression) {
+        // Versión 1: tiles crudos tras el header
+        DynamicArray<char> tiles;
+        ChunkCodec::Encode(chunk, ChunkEncoding::RAW, tiles);
+
+        out = DynamicArray<char>(sizeof(ChunkFileHeader) + tiles.size());
+        std::memcpy(out.data(), &header, sizeof(ChunkFileHeader));
+        std::memcpy(out.data() + sizeof(ChunkFileHeader), tiles.data(), tiles.size());
+        return;
+    }
+
+    // Versión 3: la codificación más pequeña para este chunk
+    DynamicArray<char> encoded;
+    ChunkEncodingHeader encoding;
+    encoding.encoding = ChunkCodec::EncodeSmallest(chunk, encoded);
+
+    // Chunk poco editado: guardar solo las diferencias con lo que generaría la seed
+    if (_baseline) {
+        std::unique_ptr<Chunk> baseline = _baseline(chunk.getChunkCoord(), header.chunkSize);
+        DynamicArray<char> delta;
+        if (baseline != nullptr && ChunkCodec::EncodeDelta(chunk, *baseline, _delta_threshold, delta) &&
+            delta.size() < encoded.size()) {
+            encoded = std::move(delta);
+            encoding.encoding = ChunkEncoding::DELTA;
+        }
+    }
+    encoding.encodedSize = static_cast<uint32_t>(encoded.size());
+    encoding.generatorVersion = _generator_version;
+    header.version = 3;
+
+    out = DynamicArray<char>(sizeof(ChunkFileHeader) + sizeof(ChunkEncodingHeader) + encoded.size());
+    char* cursor = out.data();
+
+    std::memcpy(cursor, &header, sizeof(ChunkFileHeader));
+    cursor += sizeof(ChunkFileHeader);
+
+    std::memcpy(cursor, &encoding, sizeof(ChunkEncodingHeader));
+    cursor += sizeof(ChunkEncodingHeader);
+
+    std::memcpy(cursor, encoded.data(), encoded.size());
+}
+
+std::unique_ptr<Chunk> ChunkStorage::DeserializeChunk(const char* data, size_t size, const ChunkCoord& coord,
+                                                      uint32_t* generatorVersion) const {
+    if (size < sizeof(ChunkFileHeader)) {
+        std::cout << "ERROR: Datos de chunk truncados: (" << coord.x() << ", " << coord.y() << ")\n";
+        return nullptr;
+    }
+
+    // Leer header
+    ChunkFileHeader header;
+    std::memcpy(&header, data, sizeof(ChunkFileHeader));
+
+    // Verificar magic number
+    if (header.magic[0] != 'C' || header.magic[1] != 'H' ||
+        header.magic[2] != 'N' || header.magic[3] != 'K') {
+        std::cout << "ERROR: Chunk corrupto o formato inválido: (" << coord.x() << ", " << coord.y() << ")\n";
+        return nullptr;
+    }
+
+    // Verificar versión
+    if (header.version < 1 || header.version > 3) {
+        std::cout << "ERROR: Versión de formato no soportada: " << header.version << "\n";
+        return nullptr;
+    }
+
+    // Verificar coordenadas
+    if (header.chunkX != coord.x() || header.chunkY != coord.y()) {
+        std::cout << "ERROR: Coordenadas en archivo no coinciden: "
+                << "esperado (" << coord.x() << ", " << coord.y() << "), "
+                << "encontrado (" << header.chunkX << ", " << header.chunkY << ")\n";
+        return nullptr;
+    }
+
+    // Verificar que el tamaño del chunk coincide
+    if (header.chunkSize != _chunk_size) {
+        std::cout << "WARNING: Tamaño de chunk no coincide: "
+                << header.chunkSize << " vs " << _chunk_size << "\n";
+        return nullptr;
+    }
+
+    // Verificar que la Seed del mundo sea correcta
+    if (header.seed != _seed) {
+        std::cout << "WARNING: La seed del mundo no coincide: "
+                << header.seed << " vs " << _seed << "\n";
+        return nullptr;
+    }
+
+    size_t expected = static_cast<size_t>(header.chunkSize) * header.chunkSize * sizeof(Tile);
+    if (header.tileDataSize != expected) {
+        std::cout << "ERROR: Datos de tiles incompletos: (" << coord.x() << ", " << coord.y() << ")\n";
+        return nullptr;
+    }
+
+    // Versión 1: tiles crudos; versiones 2 y 3: header de codificación + payload codificado
+    ChunkEncodingHeader encoding;
+    encoding.encodedSize = header.tileDataSize;
+    const char* cursor = data + sizeof(ChunkFileHeader);
+    size_t remaining = size - sizeof(ChunkFileHeader);
+
+    if (header.version >= 2) {
+        size_t encodingSize = (header.version == 2) ? CHUNK_ENCODING_HEADER_V2_SIZE : sizeof(ChunkEncodingHeader);
+        if (remaining < encodingSize) {
+            std::cout << "ERROR: Datos de chunk truncados: (" << coord.x() << ", " << coord.y() << ")\n";
+            return nullptr;
+        }
+        std::memcpy(&encoding, cursor, encodingSize);
+        cursor += encodingSize;
+        remaining -= encodingSize;
+
+        if (generatorVersion != nullptr) *generatorVersion = encoding.generatorVersion;
+    }
+
+    // Verificar que los datos de tiles estén completos
+    if (remaining < encoding.encodedSize) {
+        std::cout << "ERROR: Datos de tiles incompletos: (" << coord.x() << ", " << coord.y() << ")\n";
+        return nullptr;
+    }
+
+    // Crear chunk (DELTA parte de la línea base regenerada)
+    std::unique_ptr<Chunk> chunk;
+    if (encoding.encoding == ChunkEncoding::DELTA) {
+        // Otra versión del generador daría otra línea base y las ediciones se perderían
+        if (encoding.generatorVersion != _generator_version) {
+            std::cout << "ERROR: Chunk guardado como diferencias frente a la versión " << encoding.generatorVersion
+                    << " del generador (actual " << _generator_version << "): ("
+                    << coord.x() << ", " << coord.y() << ")\n";
+            return nullptr;
+        }
+        if (_baseline) chunk = _baseline(coord, header.chunkSize);
+        if (chunk == nullptr || chunk->getChunkSize() != header.chunkSize) {
+            std::cout << "ERROR: Chunk guardado como diferencias sin línea base disponible: ("
+                    << coord.x() << ", " << coord.y() << ")\n";
+            return nullptr;
+        }
+    } else {
+        chunk = std::make_unique<Chunk>(coord, header.chunkSize);
+    }
+
+    if (!ChunkCodec::Decode(cursor, encoding.encodedSize, encoding.encoding, *chunk)) {
+        std::cout << "ERROR: Datos de tiles corruptos: (" << coord.x() << ", " << coord.y() << ")\n";
+        return nullptr;
+    }
+    chunk->setState(State::LOADED);
+    chunk->markPersisted();
+
+    return chunk;
+}
+
+// Configuracion
+void ChunkStorage::SetFormat(StorageFormat format) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (format == _format) return;
+    _regions.FlushAll();
+    _format = format;
+}
+
+void ChunkStorage::SetDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (directory == _directory) return;
+
+    _directory = directory;
+    _regions.SetDirectory(directory);
+
+    // El índice se reconstruye con el siguiente acceso
+    _index.clear();
+    _index_built = false;
+    _incompatible.clear();
+    _generator_warned = false;
+}
+
+void ChunkStorage::SetGeneratorVersion(uint32_t version) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (version == _generator_version) return;
+
+    _generator_version = version;
+    _incompatible.clear();          // Se vuelven a comprobar con la nueva versión
+    _generator_warned = false;
+}
+
+// ---------- Metodos privados ----------
+
+// Formato por archivo
+std::unique_ptr<Chunk> ChunkStorage::LoadFromFile(const ChunkCoord& coord, uint32_t& generatorVersion) {
+    std::string filename = GetChunkFilePath(coord);
+
+    if (_mapped_reads) {
+        // Si no se puede mapear es que no existe: evita el exists() previo
+        MappedFile view;
+        if (!view.Open(filename)) return nullptr;
+        return DeserializeChunk(view.data(), view.size(), coord, &generatorVersion);
+    }
+
+    // Verificar si el archivo existe
+    if (!std::filesystem::exists(filename)) {
+        return nullptr;
+    }
+
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        std::cout << "ERROR: No se pudo abrir archivo para cargar: " << filename << "\n";
+        return nullptr;
+    }
+
+    // Leer el archivo completo en una sola operación
+    size_t size = static_cast<size_t>(file.tellg());
+    DynamicArray<char> payload(size);
+    file.seekg(0);
+    file.read(payload.data(), size);
+
+    if (!file.good()) {
+        std::cout << "ERROR: Fallo al leer archivo: " << filename << "\n";
+        return nullptr;
+    }
+
+    return DeserializeChunk(payload.data(), payload.size(), coord, &generatorVersion);
+}
+
+bool ChunkStorage::SaveToFile(const Chunk& chunk, const DynamicArray<char>& payload) {
+    std::filesystem::create_directories(_directory);
+
+    // Generar nombre de archivo
+    std::string filename = GetChunkFilePath(chunk.getChunkCoord());
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "ERROR: No se pudo abrir archivo para guardar: " << filename << "\n";
+        return false;
+    }
+
+    file.write(payload.data(), payload.size());
+
+    if (!file.good()) {
+        std::cout << "ERROR: Fallo al escribir chunk: " << filename << "\n";
+        return false;
+    }
+    return true;
+}
+
+// Formato por región
+std::unique_ptr<Chunk> ChunkStorage::LoadFromRegion(const ChunkCoord& coord, uint32_t& generatorVersion) {
+    RegionFile* region = _regions.Get(RegionFile::ChunkToRegion(coord), false);
+    if (region == nullptr || !region->HasChunk(coord)) return nullptr;
+
+    if (_mapped_reads) {
+        // Deserializar directamente desde el mapeo, sin buffer intermedio
+        const char* data = nullptr;
+        uint32_t length = 0;
+        if (!region->MapChunk(coord, data, length)) return nullptr;
+        return DeserializeChunk(data, length, coord, &generatorVersion);
+    }
+
+    DynamicArray<char> payload;
+    if (!region->ReadChunk(coord, payload)) return nullptr;
+
+    return DeserializeChunk(payload.data(), payload.size(), coord, &generatorVersion);
+}
+
+bool ChunkStorage::SaveToRegion(const Chunk& chunk, const DynamicArray<char>& payload) {
+    RegionFile* region = _regions.Get(RegionFile::ChunkToRegion(chunk.getChunkCoord()), true);
+    if (region == nullptr) {
+        std::cout << "ERROR: No se pudo abrir región para guardar chunk ("
+                << chunk.getChunkX() << ", " << chunk.getChunkY() << ")\n";
+        return false;
+    }
+
+    return region->WriteChunk(chunk.getChunkCoord(), payload.data(), static_cast<uint32_t>(payload.size()));
+}
+
+std::string ChunkStorage::GetChunkFilePath(const ChunkCoord& coord) const {
+    return _directory + "/chunk_" +
+           std::to_string(coord.x()) + "_" +
+           std::to_string(coord.y()) + ".chnk";
+}
+
+
+// Índice de presencia
+void ChunkStorage::EnsureIndex() {
+    if (_index_built) return;
+    _index.clear();
+    ScanDirectory();
+    _index_built = true;
+}
+
+void ChunkStorage::ScanDirectory() {
+    std::error_code error;
+    std::filesystem::directory_iterator it(_directory, error);
+    if (error) return;      // Directorio aún no creado: mundo nuevo
+
+    for (const auto& entry : it) {
+        if (!entry.is_regular_file(error)) continue;
+
+        std::string name = entry.path().filename().string();
+        ChunkCoord coord;
+
+        if (ParseCoordName(name, "region_", ".rgn", coord)) {
+            // Solo se lee la tabla de offsets, no los payloads
+            DynamicArray<ChunkCoord> chunks;
+            if (!RegionFile::ListChunks(entry.path().string(), coord, chunks)) continue;
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                _index[chunks[i]] = StorageFormat::REGION;
+            }
+        } else if (ParseCoordName(name, "chunk_", ".chnk", coord)) {
+            // Si el chunk también está en una región, la región tiene prioridad
+            if (_index.find_ptr(coord) == nullptr) _index[coord] = StorageFormat::PER_FILE;
+        }
+    }
+}
+
+bool ChunkStorage::ParseCoordName(const std::string& name, const std::string& prefix,
+                                  const std::string& extension, ChunkCoord& coord) {
+    if (name.size() <= prefix.size() + extension.size() ||
+        name.compare(0, prefix.size(), prefix) != 0 ||
+        name.compare(name.size() - extension.size(), extension.size(), extension) != 0) {
+        return false;
+    }
+
+    // "<x>_<y>" entre prefijo y extensión
+    std::string body = name.substr(prefix.size(), name.size() - prefix.size() - extension.size());
+    size_t separator = body.find('_', 1);
+    if (separator == std::string::npos) return false;
+
+    try {
+        size_t usedX = 0;
+        size_t usedY = 0;
+        int x = std::stoi(body.substr(0, separator), &usedX);
+        int y = std::stoi(body.substr(separator + 1), &usedY);
+        if (usedX != separator || usedY != body.size() - separator - 1) return false;
+        coord = ChunkCoord(x, y);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "map/manager/MappedFile.hpp"
+
+// ----- Constructores -----
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+_data(other._data),
+_size(other._size),
+#ifdef _WIN32
+_file(other._file),
+_mapping(other._mapping)
+#else
+_fd(other._fd)
+#endif
+{
+    other.Reset();
+}
+
+// ----- Destructor -----
+MappedFile::~MappedFile() {
+    Close();
+}
+
+// ----- Operadores -----
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        _data = other._data;
+        _size = other._size;
+#ifdef _WIN32
+        _file = other._file;
+        _mapping = other._mapping;
+#else
+        _fd = other._fd;
+#endif
+        other.Reset();
+    }
+    return *this;
+}
+
+// ----- Métodos -----
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    _file = file;
+    _mapping = mapping;
+    _data = static_cast<const char*>(view);
+    _size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    _fd = fd;
+    _data = static_cast<const char*>(view);
+    _size = static_cast<size_t>(info.st_size);
+#endif
+
+    return true;
+}
+
+void MappedFile::Close() {
+    if (_data == nullptr) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(_data);
+    CloseHandle(static_cast<HANDLE>(_mapping));
+    CloseHandle(static_cast<HANDLE>(_file));
+#else
+    ::munmap(const_cast<char*>(_data), _size);
+    ::close(_fd);
+#endif
+
+    Reset();
+}
+
+void MappedFile::WillNeed(size_t offset, size_t length) const {
+    if (_data == nullptr || offset >= _size) return;
+    if (offset + length > _size) length = _size - offset;
+
+#ifdef _WIN32
+    (void)length;   // Sin equivalente portable a madvise antes de Windows 8
+#else
+    // madvise exige una dirección alineada a página
+    size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t alignedOffset = offset - (offset % page);
+    ::madvise(const_cast<char*>(_data) + alignedOffset, length + (offset - alignedOffset), MADV_WILLNEED);
+#endif
+}
+
+// ---------- Metodos privados ----------
+
+void MappedFile::Reset() {
+    _data = nullptr;
+    _size = 0;
+#ifdef _WIN32
+    _file = nullptr;
+    _mapping = nullptr;
+#else
+    _fd = -1;
+#endif
+}
@@ -0,0 +1,390 @@
+#include <cstring>
+#include <iostream>
+#include <filesystem>
+
+#include "map/manager/RegionFile.hpp"
+
+// #################### RegionFile ###################
+// ----- Constructores -----
+RegionFile::RegionFile(const std::string& path, ChunkCoord regionCoord) :
+_path(path),
+_regionCoord(regionCoord) {}
+
+// ----- Destructor -----
+RegionFile::~RegionFile() {
+    _view.Close();
+    if (_file.is_open()) {
+        _file.flush();
+        _file.close();
+    }
+}
+
+// ----- Métodos -----
+bool RegionFile::Open(bool create) {
+    bool exists = std::filesystem::exists(_path);
+    if (!exists && !create) return false;
+
+    if (!exists) {
+        // Crear archivo nuevo: header + tabla vacía, alineado a sectores
+        std::ofstream newFile(_path, std::ios::binary);
+        if (!newFile.is_open()) {
+            std::cout << "ERROR: No se pudo crear archivo de región: " << _path << "\n";
+            return false;
+        }
+
+        RegionFileHeader header;
+        newFile.write(reinterpret_cast<const char*>(&header), sizeof(RegionFileHeader));
+
+        DynamicArray<char> padding(HEADER_SECTORS * SECTOR_SIZE - sizeof(RegionFileHeader));
+        std::memset(padding.data(), 0, padding.size());
+        newFile.write(padding.data(), padding.size());
+
+        if (!newFile.good()) {
+            std::cout << "ERROR: Fallo al inicializar archivo de región: " << _path << "\n";
+            return false;
+        }
+    }
+
+    _file.open(_path, std::ios::binary | std::ios::in | std::ios::out);
+    if (!_file.is_open()) {
+        std::cout << "ERROR: No se pudo abrir archivo de región: " << _path << "\n";
+        return false;
+    }
+
+    // Leer y validar header
+    RegionFileHeader header;
+    _file.read(reinterpret_cast<char*>(&header), sizeof(RegionFileHeader));
+    if (!_file.good() ||
+        header.magic[0] != 'R' || header.magic[1] != 'G' ||
+        header.magic[2] != 'N' || header.magic[3] != 'F' ||
+        header.version != 1 || header.sectorSize != SECTOR_SIZE ||
+        header.regionSize != static_cast<uint32_t>(REGION_SIZE)) {
+        std::cout << "ERROR: Archivo de región corrupto o formato inválido: " << _path << "\n";
+        _file.close();
+        return false;
+    }
+
+    // Leer tabla de offsets
+    _entries = DynamicArray<RegionEntry>(REGION_CHUNKS);
+    _file.read(reinterpret_cast<char*>(_entries.data()), REGION_CHUNKS * sizeof(RegionEntry));
+    if (!_file.good()) {
+        std::cout << "ERROR: Tabla de región incompleta: " << _path << "\n";
+        _file.close();
+        return false;
+    }
+
+    // Reconstruir mapa de sectores ocupados
+    _file.seekg(0, std::ios::end);
+    uint64_t fileSize = static_cast<uint64_t>(_file.tellg());
+    uint32_t sectorCount = static_cast<uint32_t>((fileSize + SECTOR_SIZE - 1) / SECTOR_SIZE);
+    if (sectorCount < HEADER_SECTORS) sectorCount = HEADER_SECTORS;
+
+    _usedSectors = DynamicArray<uint8_t>(sectorCount);
+    std::memset(_usedSectors.data(), 0, _usedSectors.size());
+    MarkSectors(0, HEADER_SECTORS, 1);
+
+    for (uint32_t i = 0; i < REGION_CHUNKS; ++i) {
+        const RegionEntry& entry = _entries[i];
+        if (entry.sectorOffset == 0) continue;
+
+        uint32_t count = SectorsFor(entry.byteLength);
+        if (entry.sectorOffset < HEADER_SECTORS || entry.sectorOffset + count > sectorCount) {
+            std::cout << "WARNING: Entrada de región fuera de rango, descartada: " << _path << " [" << i << "]\n";
+            _entries[i] = RegionEntry();
+            continue;
+        }
+        MarkSectors(entry.sectorOffset, count, 1);
+    }
+
+    return true;
+}
+
+void RegionFile::Flush() {
+    if (_file.is_open()) _file.flush();
+}
+
+bool RegionFile::HasChunk(const ChunkCoord& chunkCoord) const {
+    if (!_file.is_open()) return false;
+    return _entries[LocalIndex(chunkCoord)].sectorOffset != 0;
+}
+
+bool RegionFile::ReadChunk(const ChunkCoord& chunkCoord, DynamicArray<char>& out) {
+    if (!_file.is_open()) return false;
+
+    const RegionEntry& entry = _entries[LocalIndex(chunkCoord)];
+    if (entry.sectorOffset == 0 || entry.byteLength == 0) return false;
+
+    out = DynamicArray<char>(entry.byteLength);
+
+    _file.clear();
+    _file.seekg(static_cast<std::streamoff>(entry.sectorOffset) * SECTOR_SIZE);
+    _file.read(out.data(), entry.byteLength);
+
+    if (!_file.good()) {
+        std::cout << "ERROR: Fallo al leer chunk desde región: " << _path << "\n";
+        _file.clear();
+        return false;
+    }
+    return true;
+}
+
+bool RegionFile::MapChunk(const ChunkCoord& chunkCoord, const char*& data, uint32_t& length) {
+    if (!_file.is_open()) return false;
+
+    const RegionEntry& entry = _entries[LocalIndex(chunkCoord)];
+    if (entry.sectorOffset == 0 || entry.byteLength == 0) return false;
+
+    // Hacer visibles en el mapeo las escrituras que siguen en el buffer de _file
+    if (_unflushed) {
+        _file.flush();
+        _unflushed = false;
+    }
+
+    size_t offset = static_cast<size_t>(entry.sectorOffset) * SECTOR_SIZE;
+    if (!_view.IsOpen() || offset + entry.byteLength > _view.size()) {
+        // El archivo creció desde el último mapeo
+        if (!_view.Open(_path)) {
+            std::cout << "ERROR: No se pudo mapear archivo de región: " << _path << "\n";
+            return false;
+        }
+        if (offset + entry.byteLength > _view.size()) {
+            std::cout << "ERROR: Payload fuera del archivo de región: " << _path << "\n";
+            return false;
+        }
+    }
+
+    data = _view.data() + offset;
+    length = entry.byteLength;
+    return true;
+}
+
+void RegionFile::Prefetch(const ChunkCoord& chunkCoord) {
+    if (!_view.IsOpen()) return;
+
+    const RegionEntry& entry = _entries[LocalIndex(chunkCoord)];
+    if (entry.sectorOffset == 0) return;
+
+    _view.WillNeed(static_cast<size_t>(entry.sectorOffset) * SECTOR_SIZE, entry.byteLength);
+}
+
+bool RegionFile::WriteChunk(const ChunkCoord& chunkCoord, const char* data, uint32_t length) {
+    if (!_file.is_open() || length == 0) return false;
+    _unflushed = true;
+
+    uint32_t index = LocalIndex(chunkCoord);
+    RegionEntry& entry = _entries[index];
+
+    uint32_t needed = SectorsFor(length);
+    uint32_t previous = SectorsFor(entry.byteLength);
+    bool inPlace = entry.sectorOffset != 0 && previous >= needed;
+
+    // Al reubicar, la asignación anterior sigue ocupada hasta que la nueva esté escrita:
+    // si la escritura falla, la entrada sigue apuntando al payload anterior, intacto
+    uint32_t first = inPlace ? entry.sectorOffset : AllocateSectors(needed);
+
+    _file.clear();
+    _file.seekp(static_cast<std::streamoff>(first) * SECTOR_SIZE);
+    _file.write(data, length);
+
+    // Relleno hasta el límite de sector para mantener el archivo alineado
+    uint32_t padding = needed * SECTOR_SIZE - length;
+    if (padding > 0) {
+        static const char zeros[SECTOR_SIZE] = {};
+        _file.write(zeros, padding);
+    }
+
+    if (!_file.good()) {
+        std::cout << "ERROR: Fallo al escribir chunk en región: " << _path << "\n";
+        _file.clear();
+        if (!inPlace) {
+            MarkSectors(first, needed, 0);
+            return false;
+        }
+
+        // En sitio el payload anterior ya está sobrescrito: la entrada deja de ser válida
+        MarkSectors(first, previous, 0);
+        entry = RegionEntry();
+        WriteEntry(index);
+        return false;
+    }
+
+    if (inPlace) MarkSectors(first + needed, previous - needed, 0);     // Cola sobrante
+    else if (entry.sectorOffset != 0) MarkSectors(entry.sectorOffset, previous, 0);
+
+    entry.sectorOffset = first;
+    entry.byteLength = length;
+    return WriteEntry(index);
+}
+
+bool RegionFile::EraseChunk(const ChunkCoord& chunkCoord) {
+    if (!_file.is_open()) return false;
+
+    uint32_t index = LocalIndex(chunkCoord);
+    RegionEntry& entry = _entries[index];
+    if (entry.sectorOffset == 0) return false;
+
+    MarkSectors(entry.sectorOffset, SectorsFor(entry.byteLength), 0);
+    entry = RegionEntry();
+    return WriteEntry(index);
+}
+
+// Conversiones
+bool RegionFile::ListChunks(const std::string& path, const ChunkCoord& regionCoord, DynamicArray<ChunkCoord>& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    RegionFileHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(RegionFileHeader));
+    if (!file.good() ||
+        header.magic[0] != 'R' || header.magic[1] != 'G' ||
+        header.magic[2] != 'N' || header.magic[3] != 'F' ||
+        header.version != 1 || header.sectorSize != SECTOR_SIZE ||
+        header.regionSize != static_cast<uint32_t>(REGION_SIZE)) {
+        return false;
+    }
+
+    DynamicArray<RegionEntry> entries(REGION_CHUNKS);
+    file.read(reinterpret_cast<char*>(entries.data()), REGION_CHUNKS * sizeof(RegionEntry));
+    if (!file.good()) return false;
+
+    for (uint32_t i = 0; i < REGION_CHUNKS; ++i) {
+        if (entries[i].sectorOffset == 0) continue;
+
+        int localX = static_cast<int>(i % REGION_SIZE);
+        int localY = static_cast<int>(i / REGION_SIZE);
+        out.push_back(ChunkCoord(regionCoord.x() * REGION_SIZE + localX, regionCoord.y() * REGION_SIZE + localY));
+    }
+    return true;
+}
+
+ChunkCoord RegionFile::ChunkToRegion(const ChunkCoord& chunkCoord) {
+    int regionX = (chunkCoord.x() >= 0) ? chunkCoord.x() / REGION_SIZE : (chunkCoord.x() - REGION_SIZE + 1) / REGION_SIZE;
+    int regionY = (chunkCoord.y() >= 0) ? chunkCoord.y() / REGION_SIZE : (chunkCoord.y() - REGION_SIZE + 1) / REGION_SIZE;
+    return {regionX, regionY};
+}
+
+uint32_t RegionFile::LocalIndex(const ChunkCoord& chunkCoord) {
+    uint32_t localX = static_cast<uint32_t>(((chunkCoord.x() % REGION_SIZE) + REGION_SIZE) % REGION_SIZE);
+    uint32_t localY = static_cast<uint32_t>(((chunkCoord.y() % REGION_SIZE) + REGION_SIZE) % REGION_SIZE);
+    return localY * REGION_SIZE + localX;
+}
+
+// ---------- Metodos privados ----------
+
+uint32_t RegionFile::AllocateSectors(uint32_t count) {
+    uint32_t total = static_cast<uint32_t>(_usedSectors.size());
+    uint32_t runStart = HEADER_SECTORS;
+    uint32_t runLength = 0;
+
+    // First-fit sobre el mapa de sectores
+    for (uint32_t i = HEADER_SECTORS; i < total; ++i) {
+        if (_usedSectors[i]) {
+            runStart = i + 1;
+            runLength = 0;
+            continue;
+        }
+
+        if (++runLength == count) {
+            MarkSectors(runStart, count, 1);
+            return runStart;
+        }
+    }
+
+    // Sin hueco suficiente: crecer al final (reutilizando el hueco final si existe)
+    uint32_t first = (runLength > 0) ? runStart : total;
+    while (_usedSectors.size() < static_cast<size_t>(first) + count) {
+        _usedSectors.push_back(0);
+    }
+    MarkSectors(first, count, 1);
+    return first;
+}
+
+void RegionFile::MarkSectors(uint32_t first, uint32_t count, uint8_t used) {
+    for (uint32_t i = first; i < first + count && i < _usedSectors.size(); ++i) {
+        _usedSectors[i] = used;
+    }
+}
+
+bool RegionFile::WriteEntry(uint32_t index) {
+    _file.clear();
+    _file.seekp(static_cast<std::streamoff>(sizeof(RegionFileHeader) + index * sizeof(RegionEntry)));
+    _file.write(reinterpret_cast<const char*>(&_entries[index]), sizeof(RegionEntry));
+
+    if (!_file.good()) {
+        std::cout << "ERROR: Fallo al actualizar tabla de región: " << _path << "\n";
+        _file.clear();
+        return false;
+    }
+    return true;
+}
+
+// #################### RegionFileCache ###################
+// ----- Constructores -----
+RegionFileCache::RegionFileCache(const std::string& directory, size_t capacity) :
+_directory(directory),
+_capacity(capacity > 0 ? capacity : 1) {}
+
+// ----- Métodos -----
+RegionFile* RegionFileCache::Get(const ChunkCoord& regionCoord, bool create) {
+    std::unique_ptr<RegionFile>* found = _open.find_ptr(regionCoord);
+    if (found != nullptr) {
+        Touch(regionCoord);
+        return found->get();
+    }
+
+    if (create) std::filesystem::create_directories(_directory);
+
+    auto region = std::make_unique<RegionFile>(GetRegionPath(regionCoord), regionCoord);
+    if (!region->Open(create)) return nullptr;
+
+    if (_open.size() >= _capacity) EvictLeastRecent();
+
+    RegionFile* raw = _open.emplace(regionCoord, std::move(region)).get();
+    _recency.push_back(regionCoord);
+    return raw;
+}
+
+void RegionFileCache::FlushAll() {
+    for (auto it = _open.begin(); it != _open.end(); ++it) {
+        it->second()->Flush();
+    }
+}
+
+void RegionFileCache::CloseAll() {
+    _open.clear();
+    _recency.clear();
+}
+
+void RegionFileCache::SetDirectory(const std::string& directory) {
+    if (directory == _directory) return;
+    CloseAll();
+    _directory = directory;
+}
+
+std::string RegionFileCache::GetRegionPath(const ChunkCoord& regionCoord) const {
+    return _directory + "/region_" +
+           std::to_string(regionCoord.x()) + "_" +
+           std::to_string(regionCoord.y()) + ".rgn";
+}
+
+// ---------- Metodos privados ----------
+
+void RegionFileCache::Touch(const ChunkCoord& regionCoord) {
+    if (!_recency.empty() && _recency.back() == regionCoord) return;
+
+    for (auto it = _recency.begin(); it != _recency.end(); ++it) {
+        if (*it == regionCoord) {
+            _recency.erase(it);
+            break;
+        }
+    }
+    _recency.push_back(regionCoord);
+}
+
+void RegionFileCache::EvictLeastRecent() {
+    if (_recency.empty()) return;
+
+    ChunkCoord oldest = _recency.front();
+    _recency.pop_front();
+    _open.erase(oldest);    // El destructor de RegionFile hace flush y cierra
+}
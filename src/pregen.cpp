@@ -0,0 +1,299 @@
+#include "map/generator/WorldGenerator.hpp"
+#include "map/manager/ChunkStorage.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <csignal>
+#include <filesystem>
+#include <stdexcept>
+#include <algorithm>
+
+// Pregeneración sin ventana: genera y guarda en disco (formato de ChunkStorage) todos
+// los chunks de un rectángulo o de un círculo, repartiendo super-regiones entre hilos.
+// Los chunks que ya están en disco se saltan, así que si se interrumpe basta con
+// relanzarlo con los mismos parámetros para continuar.
+
+namespace {
+
+struct PregenConfig {
+    std::string directory = "world";
+    uint64_t seed = 12345;
+    uint32_t chunkSize = 128;
+
+    // Área en coordenadas de chunk: rectángulo [minX, maxX] x [minY, maxY] o círculo
+    bool useRadius = false;
+    int minX = 0, minY = 0, maxX = -1, maxY = -1;
+    int centerX = 0, centerY = 0, radius = 0;
+
+    // Mismos valores por defecto que la aplicación
+    int biomeCount = 7;
+    float biomeRadius = 500.0f;
+    float metersPerTile = 1.0f;
+    LakeConfig lakes = LakeConfig(0.01f, -0.4f);
+
+    size_t threads = 0;                     // 0 = hardware_concurrency
+    StorageFormat format = StorageFormat::REGION;
+};
+
+// Se activa con Ctrl+C: los hilos terminan la super-región en curso y se vacía el disco
+std::atomic<bool> Interrupted(false);
+
+void HandleInterrupt(int) {
+    Interrupted.store(true);
+}
+
+void PrintUsage() {
+    std::cout << "Uso: pregen --dir <directorio> --seed <semilla> --chunk-size <tiles>\n"
+              << "              (--rect <minX> <minY> <maxX> <maxY> | --radius <chunks> [--center <x> <y>])\n"
+              << "              [--threads <n>] [--format region|file]\n"
+              << "              [--biomes <n>] [--biome-radius <m>] [--meters-per-tile <m>]\n"
+              << "Coordenadas y radio en chunks. Se puede interrumpir y relanzar: continúa donde se quedó.\n"
+              << "La aplicación carga el resultado con --dir <directorio> (mismo tamaño de chunk y biomas).\n";
+}
+
+PregenConfig ParseArguments(int argc, char** argv) {
+    PregenConfig config;
+    bool hasArea = false;
+
+    auto value = [&](int& i) -> std::string {
+        if (i + 1 >= argc) throw std::invalid_argument(std::string("Falta el valor de ") + argv[i]);
+        return argv[++i];
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+
+        if (option == "--dir") config.directory = value(i);
+        else if (option == "--seed") config.seed = std::stoull(value(i));
+        else if (option == "--chunk-size") config.chunkSize = static_cast<uint32_t>(std::stoul(value(i)));
+        else if (option == "--rect") {
+            config.minX = std::stoi(value(i));
+            config.minY = std::stoi(value(i));
+            config.maxX = std::stoi(value(i));
+            config.maxY = std::stoi(value(i));
+            config.useRadius = false;
+            hasArea = true;
+        }
+        else if (option == "--radius") {
+            config.radius = std::stoi(value(i));
+            config.useRadius = true;
+            hasArea = true;
+        }
+        else if (option == "--center") {
+            config.centerX = std::stoi(value(i));
+            config.centerY = std::stoi(value(i));
+        }
+        else if (option == "--threads") config.threads = std::stoul(value(i));
+        else if (option == "--format") {
+            std::string format = value(i);
+            if (format == "region") config.format = StorageFormat::REGION;
+            else if (format == "file") config.format = StorageFormat::PER_FILE;
+            else throw std::invalid_argument("Formato desconocido: " + format);
+        }
+        else if (option == "--biomes") config.biomeCount = std::stoi(value(i));
+        else if (option == "--biome-radius") config.biomeRadius = std::stof(value(i));
+        else if (option == "--meters-per-tile") config.metersPerTile = std::stof(value(i));
+        else throw std::invalid_argument("Opción desconocida: " + option);
+    }
+
+    if (!hasArea) throw std::invalid_argument("Hace falta --rect o --radius");
+    if (config.chunkSize == 0) throw std::invalid_argument("--chunk-size debe ser mayor que 0");
+    if (config.biomeCount < 1) throw std::invalid_argument("--biomes debe ser al menos 1");
+    if (config.useRadius && config.radius < 0) throw std::invalid_argument("--radius no puede ser negativo");
+    if (!config.useRadius && (config.maxX < config.minX || config.maxY < config.minY)) {
+        throw std::invalid_argument("--rect necesita minX <= maxX y minY <= maxY");
+    }
+
+    if (config.threads == 0) config.threads = std::max(1u, std::thread::hardware_concurrency());
+    return config;
+}
+
+// Lo que determina el contenido de los chunks. Se guarda junto a ellos para no mezclar
+// mundos distintos en el mismo directorio al reanudar; la aplicación lo comprueba con --dir.
+std::string Manifest(const PregenConfig& config) {
+    std::ostringstream manifest;
+    manifest << "generatorVersion=" << WorldGenerator::GENERATOR_VERSION << "\n"
+             << "seed=" << config.seed << "\n"
+             << "chunkSize=" << config.chunkSize << "\n"
+             << "biomes=" << config.biomeCount << "\n"
+             << "biomeRadius=" << config.biomeRadius << "\n"
+             << "metersPerTile=" << config.metersPerTile << "\n"
+             << "lakeScale=" << config.lakes.scale << "\n"
+             << "lakeThreshold=" << config.lakes.threshold << "\n";
+    return manifest.str();
+}
+
+void CheckManifest(const PregenConfig& config) {
+    std::filesystem::create_directories(config.directory);
+    std::string path = config.directory + "/pregen.txt";
+    std::string expected = Manifest(config);
+
+    std::ifstream existing(path);
+    if (existing.is_open()) {
+        std::ostringstream stored;
+        stored << existing.rdbuf();
+        if (stored.str() != expected) {
+            throw std::invalid_argument("El directorio " + config.directory +
+                                        " se generó con otra configuración (ver pregen.txt)");
+        }
+        return;
+    }
+
+    std::ofstream manifest(path);
+    manifest << expected;
+}
+
+DynamicArray<ChunkCoord> AreaChunks(const PregenConfig& config) {
+    DynamicArray<ChunkCoord> coords;
+
+    if (config.useRadius) {
+        long long radiusSq = static_cast<long long>(config.radius) * config.radius;
+        for (int dy = -config.radius; dy <= config.radius; ++dy) {
+            for (int dx = -config.radius; dx <= config.radius; ++dx) {
+                if (static_cast<long long>(dx) * dx + static_cast<long long>(dy) * dy > radiusSq) continue;
+                coords.push_back(ChunkCoord(config.centerX + dx, config.centerY + dy));
+            }
+        }
+        return coords;
+    }
+
+    for (int y = config.minY; y <= config.maxY; ++y) {
+        for (int x = config.minX; x <= config.maxX; ++x) coords.push_back(ChunkCoord(x, y));
+    }
+    return coords;
+}
+
+int FloorDiv(int value, int divisor) {
+    return value >= 0 ? value / divisor : -((-(value + 1)) / divisor) - 1;
+}
+
+// Trabajos = super-regiones de WorldGenerator: cada hilo genera una entera con generateChunks
+DynamicArray<Pair<size_t, size_t>> SplitJobs(DynamicArray<ChunkCoord>& pending) {
+    const int side = WorldGenerator::SUPER_REGION_CHUNKS;
+    std::sort(pending.data(), pending.data() + pending.size(), [side](const ChunkCoord& a, const ChunkCoord& b) {
+        if (FloorDiv(a.y(), side) != FloorDiv(b.y(), side)) return FloorDiv(a.y(), side) < FloorDiv(b.y(), side);
+        if (FloorDiv(a.x(), side) != FloorDiv(b.x(), side)) return FloorDiv(a.x(), side) < FloorDiv(b.x(), side);
+        if (a.y() != b.y()) return a.y() < b.y();
+        return a.x() < b.x();
+    });
+
+    DynamicArray<Pair<size_t, size_t>> jobs;
+    size_t first = 0;
+    for (size_t i = 1; i <= pending.size(); ++i) {
+        if (i < pending.size() && FloorDiv(pending[i].x(), side) == FloorDiv(pending[first].x(), side) &&
+            FloorDiv(pending[i].y(), side) == FloorDiv(pending[first].y(), side)) {
+            continue;
+        }
+        jobs.push_back(Pair<size_t, size_t>(first, i));
+        first = i;
+    }
+    return jobs;
+}
+
+}
+
+int main(int argc, char** argv) {
+    PregenConfig config;
+    try {
+        config = ParseArguments(argc, argv);
+        CheckManifest(config);
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << "\n";
+        PrintUsage();
+        return 1;
+    }
+
+    DynamicArray<int> biomeIds;
+    for (int id = 0; id < config.biomeCount; ++id) biomeIds.push_back(id);
+
+    // Reentrante: un único generador (y su cache de semillas) para todos los hilos
+    WorldGenerator generator(biomeIds, config.lakes, config.seed, config.biomeRadius, config.metersPerTile);
+
+    // Sin línea base: los chunks se guardan completos y cargarlos no exige regenerarlos
+    ChunkStorage storage(config.directory, config.chunkSize, config.seed, config.format);
+    storage.SetGeneratorVersion(WorldGenerator::GENERATOR_VERSION);
+
+    DynamicArray<ChunkCoord> area = AreaChunks(config);
+    DynamicArray<ChunkCoord> pending;
+    for (const ChunkCoord& coord : area) {
+        if (!storage.Contains(coord)) pending.push_back(coord);
+    }
+
+    std::cout << "=== Pregeneración: semilla " << config.seed << ", chunks de " << config.chunkSize << "x"
+              << config.chunkSize << ", " << config.threads << " hilos ===\n";
+    std::cout << "  " << area.size() << " chunks en el área, " << area.size() - pending.size()
+              << " ya en disco, " << pending.size() << " pendientes\n";
+    if (pending.empty()) return 0;
+
+    DynamicArray<Pair<size_t, size_t>> jobs = SplitJobs(pending);
+
+    std::signal(SIGINT, HandleInterrupt);
+    std::signal(SIGTERM, HandleInterrupt);
+
+    std::atomic<size_t> nextJob(0);
+    std::atomic<size_t> saved(0);
+    std::atomic<size_t> failed(0);
+    std::atomic<size_t> running(config.threads);
+
+    auto worker = [&]() {
+        while (!Interrupted.load()) {
+            size_t job = nextJob.fetch_add(1);
+            if (job >= jobs.size()) break;
+
+            size_t first = jobs[job].first();
+            size_t last = jobs[job].second();
+            DynamicArray<std::unique_ptr<Chunk>> chunks = generator.generateChunks(
+                std::span<const ChunkCoord>(pending.data() + first, last - first), config.chunkSize);
+
+            // Serializar y comprimir ocurre fuera del cerrojo de ChunkStorage
+            for (const std::unique_ptr<Chunk>& chunk : chunks) {
+                if (storage.Save(*chunk)) saved.fetch_add(1);
+                else failed.fetch_add(1);
+            }
+        }
+        running.fetch_sub(1);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    DynamicArray<std::thread> workers;
+    for (size_t i = 0; i < config.threads; ++i) workers.push_back(std::thread(worker));
+
+    // Progreso una vez por segundo; cada informe vacía a disco lo escrito hasta entonces
+    auto lastReport = start;
+    while (running.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastReport < std::chrono::seconds(1)) continue;
+        lastReport = now;
+
+        storage.Flush();
+        double elapsed = std::chrono::duration<double>(now - start).count();
+        size_t done = saved.load();
+        double rate = done / elapsed;
+        double remaining = rate > 0.0 ? (pending.size() - done) / rate : 0.0;
+
+        std::cout << "  " << done << "/" << pending.size() << " (" << 100.0 * done / pending.size() << "%), "
+                  << rate << " chunks/s, quedan ~" << static_cast<long long>(remaining) << " s\n";
+    }
+
+    for (std::thread& thread : workers) thread.join();
+    storage.Flush();
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << saved.load() << " chunks guardados en " << elapsed << " s ("
+              << saved.load() / elapsed << " chunks/s)";
+    if (failed.load() > 0) std::cout << ", " << failed.load() << " con error de escritura";
+    std::cout << "\n";
+
+    if (Interrupted.load()) {
+        std::cout << "  Interrumpido: relanzar con los mismos parámetros para continuar\n";
+        return 130;
+    }
+    return failed.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,380 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <memory>
+
+#include "map/manager/ChunkCodec.hpp"
+#include "utils/LZCompressor.hpp"
+
+// Decodificadores del formato versión 2: leen bytes del disco, así que cualquier payload
+// truncado o corrupto debe devolver false sin leer ni escribir fuera de los buffers.
+// Los datos se decodifican siempre desde un buffer del tamaño exacto (visible con ASan).
+
+namespace {
+
+const ChunkEncoding Encodings[] = { ChunkEncoding::RAW, ChunkEncoding::RLE, ChunkEncoding::RLE_LZ };
+
+enum class Pattern { UNIFORM, STRIPES, NOISE };
+
+std::unique_ptr<Chunk> MakeChunk(uint32_t chunkSize, Pattern pattern, uint32_t seed = 1) {
+    auto chunk = std::make_unique<Chunk>(ChunkCoord(3, -4), chunkSize, Tile(0, false));
+    std::mt19937 rng(seed);
+
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        Tile* row = chunk->getRowData(y);
+        for (uint32_t x = 0; x < chunkSize; ++x) {
+            switch (pattern) {
+                case Pattern::UNIFORM: row[x] = Tile(4, false); break;
+                case Pattern::STRIPES: row[x] = Tile(static_cast<int>((x / 5 + y / 3) % 4), y % 7 == 0); break;
+                case Pattern::NOISE:   row[x] = Tile(static_cast<int>(rng() % 100000) - 1, (rng() & 1) != 0); break;
+            }
+        }
+    }
+    return chunk;
+}
+
+std::unique_ptr<Chunk> EmptyChunk(uint32_t chunkSize) {
+    return std::make_unique<Chunk>(ChunkCoord(3, -4), chunkSize, Tile());
+}
+
+void ExpectSameTiles(const Chunk& actual, const Chunk& expected) {
+    ASSERT_EQ(actual.getChunkSize(), expected.getChunkSize());
+    for (uint32_t y = 0; y < expected.getChunkSize(); ++y) {
+        const Tile* a = actual.getRowData(y);
+        const Tile* e = expected.getRowData(y);
+        for (uint32_t x = 0; x < expected.getChunkSize(); ++x) {
+            ASSERT_EQ(a[x].getBiomeId(), e[x].getBiomeId()) << "tile (" << x << ", " << y << ")";
+            ASSERT_EQ(a[x].hasWater(), e[x].hasWater()) << "tile (" << x << ", " << y << ")";
+        }
+    }
+}
+
+// Copia de [0, length) en un buffer propio: leer más allá es un desbordamiento real
+bool DecodePrefix(const DynamicArray<char>& data, size_t length, ChunkEncoding encoding, Chunk& chunk) {
+    DynamicArray<char> exact(data.data(), data.data() + length);
+    return ChunkCodec::Decode(exact.data(), exact.size(), encoding, chunk);
+}
+
+void Varint(DynamicArray<char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// Valor empaquetado de un tile con bioma no negativo: zigzag(bioma) << 1 | agua
+uint64_t Packed(int biome, bool water) {
+    return (static_cast<uint64_t>(biome) << 2) | (water ? 1u : 0u);
+}
+
+void Hash(DynamicArray<char>& out, uint64_t hash) {
+    for (size_t i = 0; i < sizeof(hash); ++i) out.push_back(static_cast<char>((hash >> (i * 8)) & 0xFF));
+}
+
+}
+
+// ----- Ida y vuelta -----
+TEST(ChunkCodecTest, RoundTripsEveryEncoding) {
+    const uint32_t sizes[] = { 1, 16, 37 };
+    const Pattern patterns[] = { Pattern::UNIFORM, Pattern::STRIPES, Pattern::NOISE };
+
+    for (uint32_t chunkSize : sizes) {
+        for (Pattern pattern : patterns) {
+            std::unique_ptr<Chunk> original = MakeChunk(chunkSize, pattern);
+
+            for (ChunkEncoding encoding : Encodings) {
+                DynamicArray<char> encoded;
+                ChunkCodec::Encode(*original, encoding, encoded);
+
+                std::unique_ptr<Chunk> decoded = EmptyChunk(chunkSize);
+                ASSERT_TRUE(DecodePrefix(encoded, encoded.size(), encoding, *decoded))
+                    << "codificación " << static_cast<int>(encoding) << ", chunk " << chunkSize;
+                ExpectSameTiles(*decoded, *original);
+            }
+        }
+    }
+}
+
+TEST(ChunkCodecTest, EncodeSmallestPicksTheSmallestEncoding) {
+    std::unique_ptr<Chunk> uniform = MakeChunk(32, Pattern::UNIFORM);
+    std::unique_ptr<Chunk> stripes = MakeChunk(32, Pattern::STRIPES);
+    std::unique_ptr<Chunk> noise = MakeChunk(32, Pattern::NOISE);
+
+    const Chunk* chunks[] = { uniform.get(), stripes.get(), noise.get() };
+    for (const Chunk* chunk : chunks) {
+        DynamicArray<char> smallest;
+        ChunkEncoding encoding = ChunkCodec::EncodeSmallest(*chunk, smallest);
+
+        for (ChunkEncoding other : Encodings) {
+            DynamicArray<char> encoded;
+            ChunkCodec::Encode(*chunk, other, encoded);
+            EXPECT_LE(smallest.size(), encoded.size()) << "codificación " << static_cast<int>(other);
+        }
+
+        std::unique_ptr<Chunk> decoded = EmptyChunk(32);
+        ASSERT_TRUE(DecodePrefix(smallest, smallest.size(), encoding, *decoded));
+        ExpectSameTiles(*decoded, *chunk);
+    }
+
+    DynamicArray<char> encoded;
+    EXPECT_NE(ChunkCodec::EncodeSmallest(*uniform, encoded), ChunkEncoding::RAW);
+}
+
+TEST(ChunkCodecTest, DeltaRoundTrip) {
+    std::unique_ptr<Chunk> baseline = MakeChunk(37, Pattern::STRIPES);
+    std::unique_ptr<Chunk> edited = MakeChunk(37, Pattern::STRIPES);
+    edited->getRowData(0)[0] = Tile(-1, true);          // Primer tile: salto 0
+    edited->getRowData(10)[20] = Tile(77, false);
+    edited->getRowData(36)[36] = Tile(123456, true);    // Último tile
+
+    DynamicArray<char> delta;
+    ASSERT_TRUE(ChunkCodec::EncodeDelta(*edited, *baseline, 0.1f, delta));
+
+    std::unique_ptr<Chunk> decoded = MakeChunk(37, Pattern::STRIPES);
+    ASSERT_TRUE(DecodePrefix(delta, delta.size(), ChunkEncoding::DELTA, *decoded));
+    ExpectSameTiles(*decoded, *edited);
+
+    // Sin cambios: solo hash y contador
+    DynamicArray<char> unchanged;
+    ASSERT_TRUE(ChunkCodec::EncodeDelta(*baseline, *baseline, 0.1f, unchanged));
+    EXPECT_EQ(unchanged.size(), sizeof(uint64_t) + 1);
+    std::unique_ptr<Chunk> same = MakeChunk(37, Pattern::STRIPES);
+    ASSERT_TRUE(DecodePrefix(unchanged, unchanged.size(), ChunkEncoding::DELTA, *same));
+    ExpectSameTiles(*same, *baseline);
+}
+
+TEST(ChunkCodecTest, DeltaRejectsDenseEditsAndForeignBaselines) {
+    std::unique_ptr<Chunk> baseline = MakeChunk(16, Pattern::STRIPES);
+    std::unique_ptr<Chunk> noise = MakeChunk(16, Pattern::NOISE);
+
+    DynamicArray<char> delta;
+    EXPECT_FALSE(ChunkCodec::EncodeDelta(*noise, *baseline, 0.25f, delta));
+    EXPECT_FALSE(ChunkCodec::EncodeDelta(*noise, *MakeChunk(8, Pattern::STRIPES), 1.0f, delta));
+
+    // Una línea base distinta de la usada al codificar no pasa la comprobación del hash
+    std::unique_ptr<Chunk> edited = MakeChunk(16, Pattern::STRIPES);
+    edited->getRowData(3)[3] = Tile(9, true);
+    ASSERT_TRUE(ChunkCodec::EncodeDelta(*edited, *baseline, 0.25f, delta));
+
+    std::unique_ptr<Chunk> otherBaseline = MakeChunk(16, Pattern::UNIFORM);
+    EXPECT_FALSE(DecodePrefix(delta, delta.size(), ChunkEncoding::DELTA, *otherBaseline));
+    ExpectSameTiles(*otherBaseline, *MakeChunk(16, Pattern::UNIFORM));
+}
+
+// ----- Payloads truncados -----
+TEST(ChunkCodecTest, RejectsEveryTruncation) {
+    std::unique_ptr<Chunk> original = MakeChunk(16, Pattern::STRIPES);
+
+    for (ChunkEncoding encoding : Encodings) {
+        DynamicArray<char> encoded;
+        ChunkCodec::Encode(*original, encoding, encoded);
+
+        for (size_t length = 0; length < encoded.size(); ++length) {
+            std::unique_ptr<Chunk> decoded = EmptyChunk(16);
+            EXPECT_FALSE(DecodePrefix(encoded, length, encoding, *decoded))
+                << "codificación " << static_cast<int>(encoding) << ", " << length << " de " << encoded.size() << " bytes";
+        }
+    }
+
+    std::unique_ptr<Chunk> edited = MakeChunk(16, Pattern::STRIPES);
+    for (uint32_t i = 0; i < 20; ++i) edited->getRowData(i % 16)[(i * 7) % 16] = Tile(50 + static_cast<int>(i), true);
+
+    DynamicArray<char> delta;
+    ASSERT_TRUE(ChunkCodec::EncodeDelta(*edited, *original, 0.5f, delta));
+    for (size_t length = 0; length < delta.size(); ++length) {
+        std::unique_ptr<Chunk> decoded = MakeChunk(16, Pattern::STRIPES);
+        EXPECT_FALSE(DecodePrefix(delta, length, ChunkEncoding::DELTA, *decoded)) << length << " de " << delta.size() << " bytes";
+    }
+}
+
+// ----- Payloads corruptos -----
+TEST(ChunkCodecTest, RleRejectsMalformedRuns) {
+    std::unique_ptr<Chunk> chunk = EmptyChunk(4);      // 16 tiles
+
+    DynamicArray<char> tooLong;
+    Varint(tooLong, 17);
+    Varint(tooLong, Packed(1, false));
+    EXPECT_FALSE(ChunkCodec::Decode(tooLong.data(), tooLong.size(), ChunkEncoding::RLE, *chunk));
+
+    DynamicArray<char> overflow;
+    Varint(overflow, 10);
+    Varint(overflow, Packed(1, false));
+    Varint(overflow, 10);
+    Varint(overflow, Packed(2, false));
+    EXPECT_FALSE(ChunkCodec::Decode(overflow.data(), overflow.size(), ChunkEncoding::RLE, *chunk));
+
+    DynamicArray<char> zeroRun;
+    Varint(zeroRun, 0);
+    Varint(zeroRun, Packed(1, false));
+    Varint(zeroRun, 16);
+    Varint(zeroRun, Packed(1, false));
+    EXPECT_FALSE(ChunkCodec::Decode(zeroRun.data(), zeroRun.size(), ChunkEncoding::RLE, *chunk));
+
+    DynamicArray<char> shortCount;
+    Varint(shortCount, 15);
+    Varint(shortCount, Packed(1, false));
+    EXPECT_FALSE(ChunkCodec::Decode(shortCount.data(), shortCount.size(), ChunkEncoding::RLE, *chunk));
+
+    // Varint de más de 64 bits
+    DynamicArray<char> endless(11, static_cast<char>(0xFF));
+    endless.push_back(0x01);
+    Varint(endless, Packed(1, false));
+    EXPECT_FALSE(ChunkCodec::Decode(endless.data(), endless.size(), ChunkEncoding::RLE, *chunk));
+
+    DynamicArray<char> exact;
+    Varint(exact, 16);
+    Varint(exact, Packed(1, true));
+    EXPECT_TRUE(ChunkCodec::Decode(exact.data(), exact.size(), ChunkEncoding::RLE, *chunk));
+    EXPECT_EQ(chunk->at(3, 3).getBiomeId(), 1);
+    EXPECT_TRUE(chunk->at(3, 3).hasWater());
+}
+
+TEST(ChunkCodecTest, RleLzRejectsBadSizesAndMatches) {
+    std::unique_ptr<Chunk> chunk = EmptyChunk(4);
+
+    // Tamaño RLE declarado nulo o mayor que la cota por tile
+    DynamicArray<char> zero;
+    Varint(zero, 0);
+    zero.push_back(0);
+    EXPECT_FALSE(ChunkCodec::Decode(zero.data(), zero.size(), ChunkEncoding::RLE_LZ, *chunk));
+
+    DynamicArray<char> huge;
+    Varint(huge, 1ull << 40);
+    huge.push_back(0);
+    EXPECT_FALSE(ChunkCodec::Decode(huge.data(), huge.size(), ChunkEncoding::RLE_LZ, *chunk));
+
+    // El flujo LZ produce menos bytes de los declarados
+    DynamicArray<char> shortStream;
+    Varint(shortStream, 3);
+    shortStream.push_back(static_cast<char>(0x20));     // 2 literales, sin match
+    shortStream.push_back(16);
+    shortStream.push_back(4);
+    EXPECT_FALSE(ChunkCodec::Decode(shortStream.data(), shortStream.size(), ChunkEncoding::RLE_LZ, *chunk));
+
+    // Match que apunta antes del inicio de la salida
+    DynamicArray<char> backReference;
+    Varint(backReference, 6);
+    backReference.push_back(static_cast<char>(0x10));   // 1 literal + match de 4
+    backReference.push_back(16);
+    backReference.push_back(5);                         // offset 5 > 1 byte escrito
+    backReference.push_back(0);
+    backReference.push_back(static_cast<char>(0x10));
+    backReference.push_back(4);
+    EXPECT_FALSE(ChunkCodec::Decode(backReference.data(), backReference.size(), ChunkEncoding::RLE_LZ, *chunk));
+
+    // Flujo RLE válido para LZ pero que no describe el chunk
+    DynamicArray<char> rle;
+    Varint(rle, 15);
+    Varint(rle, Packed(1, false));
+    DynamicArray<char> wrapped;
+    Varint(wrapped, rle.size());
+    LZCompressor::compress(reinterpret_cast<const uint8_t*>(rle.data()), rle.size(), wrapped);
+    EXPECT_FALSE(ChunkCodec::Decode(wrapped.data(), wrapped.size(), ChunkEncoding::RLE_LZ, *chunk));
+}
+
+TEST(ChunkCodecTest, DeltaRejectsBadCountsAndGaps) {
+    std::unique_ptr<Chunk> baseline = MakeChunk(4, Pattern::STRIPES);
+    uint64_t hash = ChunkCodec::HashTiles(*baseline);
+
+    auto decode = [&](const DynamicArray<char>& data) {
+        std::unique_ptr<Chunk> target = MakeChunk(4, Pattern::STRIPES);
+        return DecodePrefix(data, data.size(), ChunkEncoding::DELTA, *target);
+    };
+
+    DynamicArray<char> valid;
+    Hash(valid, hash);
+    Varint(valid, 2);
+    Varint(valid, 0);
+    Varint(valid, Packed(9, false));
+    Varint(valid, 15);
+    Varint(valid, Packed(9, true));
+    EXPECT_TRUE(decode(valid));
+
+    DynamicArray<char> tooMany;
+    Hash(tooMany, hash);
+    Varint(tooMany, 17);
+    EXPECT_FALSE(decode(tooMany));
+
+    DynamicArray<char> repeated;         // Salto 0 después del primer cambio: mismo tile dos veces
+    Hash(repeated, hash);
+    Varint(repeated, 2);
+    Varint(repeated, 3);
+    Varint(repeated, Packed(9, false));
+    Varint(repeated, 0);
+    Varint(repeated, Packed(9, false));
+    EXPECT_FALSE(decode(repeated));
+
+    DynamicArray<char> pastEnd;
+    Hash(pastEnd, hash);
+    Varint(pastEnd, 2);
+    Varint(pastEnd, 10);
+    Varint(pastEnd, Packed(9, false));
+    Varint(pastEnd, 6);                  // 10 + 6 = 16, fuera de un chunk de 16 tiles
+    Varint(pastEnd, Packed(9, false));
+    EXPECT_FALSE(decode(pastEnd));
+
+    DynamicArray<char> trailing;
+    Hash(trailing, hash);
+    Varint(trailing, 1);
+    Varint(trailing, 2);
+    Varint(trailing, Packed(9, false));
+    trailing.push_back(0);
+    EXPECT_FALSE(decode(trailing));
+
+    DynamicArray<char> wrongHash;
+    Hash(wrongHash, hash ^ 1);
+    Varint(wrongHash, 0);
+    EXPECT_FALSE(decode(wrongHash));
+}
+
+// Bytes alterados al azar: puede decodificar o no, pero nunca fuera de los buffers
+TEST(ChunkCodecTest, SurvivesRandomCorruption) {
+    std::mt19937 rng(29);
+    std::unique_ptr<Chunk> original = MakeChunk(16, Pattern::STRIPES);
+    std::unique_ptr<Chunk> edited = MakeChunk(16, Pattern::STRIPES);
+    for (uint32_t i = 0; i < 12; ++i) edited->getRowData((i * 5) % 16)[(i * 3) % 16] = Tile(40, true);
+
+    DynamicArray<char> payloads[4];
+    ChunkEncoding encodings[4] = { ChunkEncoding::RAW, ChunkEncoding::RLE, ChunkEncoding::RLE_LZ, ChunkEncoding::DELTA };
+    for (int e = 0; e < 3; ++e) ChunkCodec::Encode(*original, encodings[e], payloads[e]);
+    ASSERT_TRUE(ChunkCodec::EncodeDelta(*edited, *original, 0.5f, payloads[3]));
+
+    for (int e = 0; e < 4; ++e) {
+        for (int trial = 0; trial < 2000; ++trial) {
+            DynamicArray<char> corrupted(payloads[e].data(), payloads[e].data() + payloads[e].size());
+            int flips = 1 + static_cast<int>(rng() % 3);
+            for (int f = 0; f < flips; ++f) corrupted[rng() % corrupted.size()] ^= static_cast<char>(1 + rng() % 255);
+
+            size_t length = (trial % 4 == 0) ? rng() % (corrupted.size() + 1) : corrupted.size();
+            std::unique_ptr<Chunk> decoded = (encodings[e] == ChunkEncoding::DELTA) ? MakeChunk(16, Pattern::STRIPES)
+                                                                                   : EmptyChunk(16);
+            DecodePrefix(corrupted, length, encodings[e], *decoded);
+        }
+    }
+}
+
+// ----- LZCompressor -----
+TEST(LZCompressorTest, RoundTripsAndRejectsTruncation) {
+    std::mt19937 rng(7);
+    DynamicArray<uint8_t> inputs[3];
+    for (int i = 0; i < 5000; ++i) inputs[0].push_back(static_cast<uint8_t>(i % 13));    // Repetitivo
+    for (int i = 0; i < 5000; ++i) inputs[1].push_back(static_cast<uint8_t>(rng()));     // Incompresible
+    for (int i = 0; i < 3; ++i) inputs[2].push_back(static_cast<uint8_t>(i));            // Menor que un match
+
+    for (const DynamicArray<uint8_t>& input : inputs) {
+        DynamicArray<char> compressed;
+        LZCompressor::compress(input.data(), input.size(), compressed);
+
+        DynamicArray<uint8_t> output(input.size(), 0);
+        ASSERT_TRUE(LZCompressor::decompress(reinterpret_cast<const uint8_t*>(compressed.data()), compressed.size(),
+                                             output.data(), output.size()));
+        for (size_t i = 0; i < input.size(); ++i) ASSERT_EQ(output[i], input[i]);
+
+        for (size_t length = 0; length < compressed.size(); ++length) {
+            DynamicArray<uint8_t> prefix(reinterpret_cast<const uint8_t*>(compressed.data()),
+                                         reinterpret_cast<const uint8_t*>(compressed.data()) + length);
+            EXPECT_FALSE(LZCompressor::decompress(prefix.data(), prefix.size(), output.data(), output.size()))
+                << length << " de " << compressed.size() << " bytes";
+        }
+    }
+}
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <random>
+
+#include "map/generator/ChunkGenerationPool.hpp"
+
+// Cancelación y coalescencia del pool: cada petición aceptada por Submit se resuelve
+// exactamente una vez, por TakeCompleted, por Claim (entregado) o por Claim (cancelado),
+// aunque queden entradas obsoletas en _queue o _completed tras volver a pedirse.
+
+namespace {
+
+// Un solo worker y chunks grandes: mientras genera el primero, los siguientes siguen en cola
+const uint32_t BigChunk = 1024;
+
+WorldGenerator MakeGenerator() {
+    return WorldGenerator(DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}, LakeConfig(0.01f, -0.4f), 12345, 500.0f, 1.0f);
+}
+
+// Espera a que el worker haya empezado (o terminado) algún trabajo
+void WaitUntilStarted(const ChunkGenerationPool& pool) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (pool.GetRunningCount() == 0 && pool.GetGeneratedCount() == 0) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "ningún worker empezó";
+        std::this_thread::yield();
+    }
+}
+
+DynamicArray<GeneratedChunk> TakeAll(ChunkGenerationPool& pool) {
+    DynamicArray<GeneratedChunk> out;
+    pool.TakeCompleted(out);
+    return out;
+}
+
+size_t CountCoord(const DynamicArray<GeneratedChunk>& chunks, const ChunkCoord& coord) {
+    size_t count = 0;
+    for (const GeneratedChunk& generated : chunks) {
+        if (generated.chunk->getChunkCoord() == coord) ++count;
+    }
+    return count;
+}
+
+}
+
+// ----- Coalescencia -----
+TEST(ChunkGenerationPoolTest, SubmitCoalescesInFlightRequests) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, 16, 2);
+
+    EXPECT_TRUE(pool.Submit(ChunkCoord(1, 2)));
+    EXPECT_FALSE(pool.Submit(ChunkCoord(1, 2)));
+    EXPECT_TRUE(pool.IsInFlight(ChunkCoord(1, 2)));
+
+    pool.WaitIdle();
+    EXPECT_FALSE(pool.Submit(ChunkCoord(1, 2)));       // Terminado pero sin recoger: sigue en vuelo
+
+    DynamicArray<GeneratedChunk> done = TakeAll(pool);
+    ASSERT_EQ(done.size(), 1u);
+    EXPECT_EQ(done[0].chunk->getChunkCoord(), ChunkCoord(1, 2));
+    EXPECT_EQ(done[0].chunk->getChunkSize(), 16u);
+    EXPECT_FALSE(pool.IsInFlight(ChunkCoord(1, 2)));
+    EXPECT_EQ(pool.GetGeneratedCount(), 1u);
+
+    // Recogido: una petición nueva vuelve a generarlo
+    EXPECT_TRUE(pool.Submit(ChunkCoord(1, 2)));
+    pool.WaitIdle();
+    EXPECT_EQ(TakeAll(pool).size(), 1u);
+    EXPECT_EQ(pool.GetGeneratedCount(), 2u);
+}
+
+TEST(ChunkGenerationPoolTest, TakeCompletedRespectsMaxChunks) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, 16, 2);
+
+    for (int i = 0; i < 5; ++i) pool.Submit(ChunkCoord(i, 0));
+    pool.WaitIdle();
+
+    DynamicArray<GeneratedChunk> out;
+    EXPECT_EQ(pool.TakeCompleted(out, 2), 2u);
+    EXPECT_EQ(pool.TakeCompleted(out, 2), 2u);
+    EXPECT_EQ(pool.TakeCompleted(out, 2), 1u);
+    EXPECT_EQ(pool.TakeCompleted(out, 2), 0u);
+    ASSERT_EQ(out.size(), 5u);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(CountCoord(out, ChunkCoord(i, 0)), 1u);
+    EXPECT_EQ(pool.GetInFlightCount(), 0u);
+}
+
+// ----- Claim -----
+TEST(ChunkGenerationPoolTest, ClaimUnknownCoordReturnsFalse) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, 16, 1);
+
+    GeneratedChunk out;
+    EXPECT_FALSE(pool.Claim(ChunkCoord(9, 9), out));
+    EXPECT_EQ(out.chunk, nullptr);
+}
+
+TEST(ChunkGenerationPoolTest, ClaimCancelsJobNoWorkerStarted) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, BigChunk, 1);
+
+    ASSERT_TRUE(pool.Submit(ChunkCoord(0, 0)));
+    ASSERT_TRUE(pool.Submit(ChunkCoord(1, 0)));        // Detrás de (0, 0) en el único worker
+
+    GeneratedChunk out;
+    EXPECT_FALSE(pool.Claim(ChunkCoord(1, 0), out));
+    EXPECT_EQ(out.chunk, nullptr);
+    EXPECT_FALSE(pool.IsInFlight(ChunkCoord(1, 0)));
+
+    // La entrada obsoleta de _queue se descarta sin generar nada
+    pool.WaitIdle();
+    DynamicArray<GeneratedChunk> done = TakeAll(pool);
+    ASSERT_EQ(done.size(), 1u);
+    EXPECT_EQ(done[0].chunk->getChunkCoord(), ChunkCoord(0, 0));
+    EXPECT_EQ(pool.GetGeneratedCount(), 1u);
+    EXPECT_EQ(pool.GetInFlightCount(), 0u);
+}
+
+TEST(ChunkGenerationPoolTest, ClaimWaitsForStartedJob) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, BigChunk, 1);
+
+    ASSERT_TRUE(pool.Submit(ChunkCoord(-3, 4)));
+    WaitUntilStarted(pool);
+
+    GeneratedChunk out;
+    ASSERT_TRUE(pool.Claim(ChunkCoord(-3, 4), out));
+    ASSERT_NE(out.chunk, nullptr);
+    EXPECT_EQ(out.chunk->getChunkCoord(), ChunkCoord(-3, 4));
+    EXPECT_FALSE(pool.IsInFlight(ChunkCoord(-3, 4)));
+
+    // La entrada de _completed que deja Claim no entrega el chunk otra vez
+    pool.WaitIdle();
+    EXPECT_EQ(TakeAll(pool).size(), 0u);
+    EXPECT_EQ(pool.GetGeneratedCount(), 1u);
+}
+
+TEST(ChunkGenerationPoolTest, ClaimTakesFinishedJob) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, 16, 1);
+
+    ASSERT_TRUE(pool.Submit(ChunkCoord(5, 5)));
+    pool.WaitIdle();
+
+    GeneratedChunk out;
+    ASSERT_TRUE(pool.Claim(ChunkCoord(5, 5), out));
+    EXPECT_EQ(out.chunk->getChunkCoord(), ChunkCoord(5, 5));
+    EXPECT_EQ(TakeAll(pool).size(), 0u);
+}
+
+// ----- Entradas obsoletas tras volver a pedir -----
+TEST(ChunkGenerationPoolTest, ResubmitAfterCancelGeneratesOnce) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, BigChunk, 1);
+
+    ASSERT_TRUE(pool.Submit(ChunkCoord(0, 0)));
+    ASSERT_TRUE(pool.Submit(ChunkCoord(1, 0)));
+
+    GeneratedChunk out;
+    ASSERT_FALSE(pool.Claim(ChunkCoord(1, 0), out));
+    ASSERT_TRUE(pool.Submit(ChunkCoord(1, 0)));        // _queue tiene ahora dos entradas de (1, 0)
+
+    pool.WaitIdle();
+    DynamicArray<GeneratedChunk> done = TakeAll(pool);
+    ASSERT_EQ(done.size(), 2u);
+    EXPECT_EQ(CountCoord(done, ChunkCoord(0, 0)), 1u);
+    EXPECT_EQ(CountCoord(done, ChunkCoord(1, 0)), 1u);
+    EXPECT_EQ(pool.GetGeneratedCount(), 2u);
+}
+
+TEST(ChunkGenerationPoolTest, ResubmitAfterClaimIgnoresStaleCompletion) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, BigChunk, 1);
+
+    ASSERT_TRUE(pool.Submit(ChunkCoord(2, 2)));
+    pool.WaitIdle();
+    GeneratedChunk claimed;
+    ASSERT_TRUE(pool.Claim(ChunkCoord(2, 2), claimed));   // Deja (2, 2) obsoleto en _completed
+
+    // Se vuelve a pedir detrás de otro chunk: la entrada obsoleta no debe recoger el trabajo nuevo
+    ASSERT_TRUE(pool.Submit(ChunkCoord(3, 3)));
+    ASSERT_TRUE(pool.Submit(ChunkCoord(2, 2)));
+    DynamicArray<GeneratedChunk> early = TakeAll(pool);
+    EXPECT_EQ(CountCoord(early, ChunkCoord(2, 2)), 0u);
+    EXPECT_TRUE(pool.IsInFlight(ChunkCoord(2, 2)));
+
+    pool.WaitIdle();
+    DynamicArray<GeneratedChunk> done = TakeAll(pool);
+    EXPECT_EQ(CountCoord(early, ChunkCoord(3, 3)) + CountCoord(done, ChunkCoord(3, 3)), 1u);
+    EXPECT_EQ(CountCoord(done, ChunkCoord(2, 2)), 1u);
+    EXPECT_EQ(TakeAll(pool).size(), 0u);
+    EXPECT_EQ(pool.GetGeneratedCount(), 3u);
+    EXPECT_EQ(pool.GetInFlightCount(), 0u);
+}
+
+// ----- WaitIdle -----
+TEST(ChunkGenerationPoolTest, WaitIdleReturnsWhenOnlyCancelledEntriesRemain) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, BigChunk, 1);
+
+    ASSERT_TRUE(pool.Submit(ChunkCoord(0, 0)));
+    for (int i = 1; i <= 4; ++i) ASSERT_TRUE(pool.Submit(ChunkCoord(i, 0)));
+
+    GeneratedChunk out;
+    for (int i = 1; i <= 4; ++i) EXPECT_FALSE(pool.Claim(ChunkCoord(i, 0), out));
+
+    pool.WaitIdle();
+    EXPECT_EQ(pool.GetRunningCount(), 0u);
+    EXPECT_EQ(pool.GetGeneratedCount(), 1u);
+    EXPECT_EQ(TakeAll(pool).size(), 1u);
+}
+
+TEST(ChunkGenerationPoolTest, WaitIdleOnEmptyPoolReturns) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, 16, 3);
+    pool.WaitIdle();
+    EXPECT_EQ(pool.GetInFlightCount(), 0u);
+}
+
+// ----- Mezcla aleatoria -----
+// El hilo dueño mezcla Submit, Claim y TakeCompleted; IsInFlight antes de cada Claim dice
+// si la llamada resuelve una petición (solo el dueño retira trabajos del pool)
+TEST(ChunkGenerationPoolTest, EveryRequestResolvesExactlyOnce) {
+    WorldGenerator generator = MakeGenerator();
+    ChunkGenerationPool pool(&generator, 16, 4);
+    std::mt19937 rng(40);
+
+    const int coordCount = 24;
+    DynamicArray<int> submitted(coordCount, 0);
+    DynamicArray<int> resolved(coordCount, 0);
+
+    auto record = [&](DynamicArray<GeneratedChunk>& chunks) {
+        for (GeneratedChunk& generated : chunks) {
+            ASSERT_NE(generated.chunk, nullptr);
+            ++resolved[generated.chunk->getChunkCoord().x()];
+        }
+        chunks.clear();
+    };
+
+    DynamicArray<GeneratedChunk> taken;
+    for (int step = 0; step < 3000; ++step) {
+        int index = static_cast<int>(rng() % coordCount);
+        ChunkCoord coord(index, 0);
+
+        switch (rng() % 3) {
+            case 0:
+                if (pool.Submit(coord)) ++submitted[index];
+                break;
+            case 1: {
+                bool inFlight = pool.IsInFlight(coord);
+                GeneratedChunk out;
+                bool delivered = pool.Claim(coord, out);
+                EXPECT_EQ(delivered, out.chunk != nullptr);
+                if (delivered) {
+                    EXPECT_EQ(out.chunk->getChunkCoord(), coord);
+                }
+                if (inFlight) {
+                    ++resolved[index];
+                } else {
+                    EXPECT_FALSE(delivered);
+                }
+                break;
+            }
+            case 2:
+                pool.TakeCompleted(taken, 1 + rng() % 4);
+                record(taken);
+                break;
+        }
+    }
+
+    pool.WaitIdle();
+    pool.TakeCompleted(taken);
+    record(taken);
+
+    EXPECT_EQ(pool.GetInFlightCount(), 0u);
+    for (int i = 0; i < coordCount; ++i) EXPECT_EQ(resolved[i], submitted[i]) << "coord " << i;
+}
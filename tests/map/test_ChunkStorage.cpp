@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <cstring>
+#include <random>
+#include <memory>
+#include <string>
+
+#include "map/manager/ChunkStorage.hpp"
+#include "map/manager/ChunkFileFormat.hpp"
+#include "map/manager/ChunkCodec.hpp"
+
+// Versión del generador en el formato 3: un chunk guardado como diferencias frente a la
+// línea base de otra versión no se carga ni se sobrescribe; los guardados completos sí se
+// cargan. Los chunks de la versión 2 se leen como generados antes de la versión 1.
+
+namespace {
+
+const uint32_t Size = 32;
+const uint64_t Seed = 777;
+
+// Línea base de un "generador": ruido que depende de la coordenada y de la variante
+std::unique_ptr<Chunk> Generated(const ChunkCoord& coord, uint32_t chunkSize, uint32_t variant) {
+    auto chunk = std::make_unique<Chunk>(coord, chunkSize, Tile());
+    std::mt19937 rng(static_cast<uint32_t>(coord.x() * 73856093) ^ static_cast<uint32_t>(coord.y() * 19349663) ^ variant);
+    for (uint32_t y = 0; y < chunkSize; ++y) {
+        Tile* row = chunk->getRowData(y);
+        for (uint32_t x = 0; x < chunkSize; ++x) row[x] = Tile(static_cast<int>(rng() % 7), (rng() & 3) == 0);
+    }
+    return chunk;
+}
+
+BaselineProvider Generator(uint32_t variant) {
+    return [variant](const ChunkCoord& coord, uint32_t chunkSize) { return Generated(coord, chunkSize, variant); };
+}
+
+// Línea base con unos pocos tiles editados: se guarda como DELTA
+std::unique_ptr<Chunk> Edited(const ChunkCoord& coord, uint32_t variant) {
+    auto chunk = Generated(coord, Size, variant);
+    for (uint32_t i = 0; i < 5; ++i) chunk->getRowData(i * 3)[i * 5] = Tile(42, true);
+    return chunk;
+}
+
+void ExpectSameTiles(const Chunk& actual, const Chunk& expected) {
+    ASSERT_EQ(actual.getChunkSize(), expected.getChunkSize());
+    for (uint32_t y = 0; y < expected.getChunkSize(); ++y) {
+        const Tile* a = actual.getRowData(y);
+        const Tile* e = expected.getRowData(y);
+        for (uint32_t x = 0; x < expected.getChunkSize(); ++x) {
+            ASSERT_EQ(a[x].getBiomeId(), e[x].getBiomeId()) << "tile (" << x << ", " << y << ")";
+            ASSERT_EQ(a[x].hasWater(), e[x].hasWater()) << "tile (" << x << ", " << y << ")";
+        }
+    }
+}
+
+ChunkEncodingHeader EncodingOf(const DynamicArray<char>& payload) {
+    ChunkEncodingHeader encoding;
+    std::memcpy(&encoding, payload.data() + sizeof(ChunkFileHeader), sizeof(ChunkEncodingHeader));
+    return encoding;
+}
+
+// Payload de la versión 2: header de codificación sin generatorVersion
+DynamicArray<char> VersionTwo(const DynamicArray<char>& versionThree) {
+    ChunkFileHeader header;
+    std::memcpy(&header, versionThree.data(), sizeof(ChunkFileHeader));
+    header.version = 2;
+
+    size_t skipped = sizeof(ChunkEncodingHeader) - CHUNK_ENCODING_HEADER_V2_SIZE;
+    DynamicArray<char> out(versionThree.size() - skipped);
+    std::memcpy(out.data(), &header, sizeof(ChunkFileHeader));
+    std::memcpy(out.data() + sizeof(ChunkFileHeader), versionThree.data() + sizeof(ChunkFileHeader), CHUNK_ENCODING_HEADER_V2_SIZE);
+    std::memcpy(out.data() + sizeof(ChunkFileHeader) + CHUNK_ENCODING_HEADER_V2_SIZE,
+                versionThree.data() + sizeof(ChunkFileHeader) + sizeof(ChunkEncodingHeader),
+                versionThree.size() - sizeof(ChunkFileHeader) - sizeof(ChunkEncodingHeader));
+    return out;
+}
+
+class ChunkStorageTest : public ::testing::Test {
+protected:
+    std::string _directory;
+
+    void SetUp() override {
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        _directory = (std::filesystem::temp_directory_path() / (std::string("storage_test_") + info->name())).string();
+        std::filesystem::remove_all(_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_directory);
+    }
+
+    std::unique_ptr<ChunkStorage> Open(uint32_t generatorVersion, bool baseline) {
+        auto storage = std::make_unique<ChunkStorage>(_directory, Size, Seed);
+        storage->SetGeneratorVersion(generatorVersion);
+        if (baseline) storage->SetBaselineProvider(Generator(generatorVersion));
+        return storage;
+    }
+};
+
+}
+
+// ----- Versión del generador -----
+TEST_F(ChunkStorageTest, WritesGeneratorVersion) {
+    auto storage = Open(4, true);
+    DynamicArray<char> payload;
+    storage->SerializeChunk(*Edited(ChunkCoord(1, 2), 4), payload);
+
+    // Los campos empaquetados se copian antes de compararlos
+    ChunkFileHeader header;
+    std::memcpy(&header, payload.data(), sizeof(ChunkFileHeader));
+    uint32_t formatVersion = header.version;
+    ChunkEncodingHeader encoding = EncodingOf(payload);
+    ChunkEncoding used = encoding.encoding;
+    uint32_t generatorVersion = encoding.generatorVersion;
+    EXPECT_EQ(formatVersion, 3u);
+    EXPECT_EQ(used, ChunkEncoding::DELTA);
+    EXPECT_EQ(generatorVersion, 4u);
+
+    uint32_t version = 0;
+    auto chunk = storage->DeserializeChunk(payload.data(), payload.size(), ChunkCoord(1, 2), &version);
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(version, 4u);
+    ExpectSameTiles(*chunk, *Edited(ChunkCoord(1, 2), 4));
+}
+
+TEST_F(ChunkStorageTest, DeltaFromOtherGeneratorIsRefusedAndKept) {
+    const ChunkCoord coord(-3, 5);
+    {
+        auto storage = Open(1, true);
+        ASSERT_TRUE(storage->Save(*Edited(coord, 1)));
+    }
+
+    // Otra versión: la línea base ya no es la misma, las ediciones no se pueden reconstruir
+    {
+        auto storage = Open(2, true);
+        EXPECT_EQ(storage->Load(coord), nullptr);
+        EXPECT_TRUE(storage->Contains(coord));
+        EXPECT_EQ(storage->GetIncompatibleCount(), 1u);
+
+        // El chunk regenerado no sustituye al guardado
+        EXPECT_FALSE(storage->Save(*Generated(coord, Size, 2)));
+        EXPECT_EQ(storage->Load(coord), nullptr);
+    }
+
+    // Con la versión original las ediciones siguen ahí
+    auto storage = Open(1, true);
+    auto chunk = storage->Load(coord);
+    ASSERT_NE(chunk, nullptr);
+    ExpectSameTiles(*chunk, *Edited(coord, 1));
+    EXPECT_EQ(storage->GetIncompatibleCount(), 0u);
+}
+
+TEST_F(ChunkStorageTest, EraseReleasesIncompatibleChunk) {
+    const ChunkCoord coord(0, 0);
+    {
+        auto storage = Open(1, true);
+        ASSERT_TRUE(storage->Save(*Edited(coord, 1)));
+    }
+
+    auto storage = Open(2, true);
+    EXPECT_EQ(storage->Load(coord), nullptr);
+    EXPECT_TRUE(storage->Erase(coord));
+    EXPECT_EQ(storage->GetIncompatibleCount(), 0u);
+
+    ASSERT_TRUE(storage->Save(*Edited(coord, 2)));
+    auto chunk = storage->Load(coord);
+    ASSERT_NE(chunk, nullptr);
+    ExpectSameTiles(*chunk, *Edited(coord, 2));
+}
+
+TEST_F(ChunkStorageTest, FullEncodingLoadsAcrossGeneratorVersions) {
+    const ChunkCoord coord(7, 7);
+    {
+        // Sin línea base se guarda completo y no depende del generador
+        auto storage = Open(1, false);
+        ASSERT_TRUE(storage->Save(*Edited(coord, 1)));
+    }
+
+    auto storage = Open(2, true);
+    auto chunk = storage->Load(coord);
+    ASSERT_NE(chunk, nullptr);
+    ExpectSameTiles(*chunk, *Edited(coord, 1));
+    EXPECT_EQ(storage->GetIncompatibleCount(), 0u);
+
+    // Cargado, ya es un chunk normal: se puede volver a guardar
+    EXPECT_TRUE(storage->Save(*chunk));
+}
+
+// ----- Versión 2 -----
+TEST_F(ChunkStorageTest, ReadsVersionTwoAsUnversioned) {
+    const ChunkCoord coord(2, -1);
+    auto storage = Open(0, false);
+    DynamicArray<char> payload;
+    storage->SerializeChunk(*Edited(coord, 0), payload);
+
+    DynamicArray<char> old = VersionTwo(payload);
+    uint32_t version = 99;
+    auto chunk = storage->DeserializeChunk(old.data(), old.size(), coord, &version);
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(version, 0u);
+    ExpectSameTiles(*chunk, *Edited(coord, 0));
+
+    // Truncado dentro del header de codificación
+    EXPECT_EQ(storage->DeserializeChunk(old.data(), sizeof(ChunkFileHeader) + CHUNK_ENCODING_HEADER_V2_SIZE - 1, coord), nullptr);
+}
+
+TEST_F(ChunkStorageTest, VersionTwoDeltaIsRefusedByVersionedGenerator) {
+    const ChunkCoord coord(4, 4);
+    DynamicArray<char> payload;
+    Open(0, true)->SerializeChunk(*Edited(coord, 0), payload);
+    ChunkEncoding used = EncodingOf(payload).encoding;
+    ASSERT_EQ(used, ChunkEncoding::DELTA);
+    DynamicArray<char> old = VersionTwo(payload);
+
+    EXPECT_EQ(Open(1, true)->DeserializeChunk(old.data(), old.size(), coord), nullptr);
+
+    auto chunk = Open(0, true)->DeserializeChunk(old.data(), old.size(), coord);
+    ASSERT_NE(chunk, nullptr);
+    ExpectSameTiles(*chunk, *Edited(coord, 0));
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "map/manager/RegionFile.hpp"
+
+// Asignador de sectores de RegionFile: reutilización first-fit, reubicación al crecer,
+// reescritura en sitio al encoger, borrado y reconstrucción del mapa al reabrir.
+
+namespace {
+
+const uint32_t Sector = RegionFile::SECTOR_SIZE;
+const uint32_t FirstSector = RegionFile::HEADER_SECTORS;
+
+class RegionFileTest : public ::testing::Test {
+protected:
+    std::string _directory;
+    std::string _path;
+
+    void SetUp() override {
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        _directory = (std::filesystem::temp_directory_path() / (std::string("region_test_") + info->name())).string();
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+        _path = _directory + "/region_0_0.rgn";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(_directory);
+    }
+
+    // Entrada de la tabla tal como está en disco
+    RegionEntry EntryOnDisk(const ChunkCoord& coord) const {
+        RegionEntry entry;
+        std::ifstream file(_path, std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(sizeof(RegionFileHeader) + RegionFile::LocalIndex(coord) * sizeof(RegionEntry)));
+        file.read(reinterpret_cast<char*>(&entry), sizeof(RegionEntry));
+        return entry;
+    }
+};
+
+DynamicArray<char> Payload(uint32_t length, char seed) {
+    DynamicArray<char> data;
+    data.reserve(length);
+    for (uint32_t i = 0; i < length; ++i) data.push_back(static_cast<char>(seed + i * 7));
+    return data;
+}
+
+bool Write(RegionFile& region, const ChunkCoord& coord, const DynamicArray<char>& data) {
+    return region.WriteChunk(coord, data.data(), static_cast<uint32_t>(data.size()));
+}
+
+void ExpectPayload(RegionFile& region, const ChunkCoord& coord, const DynamicArray<char>& expected) {
+    DynamicArray<char> read;
+    ASSERT_TRUE(region.ReadChunk(coord, read));
+    ASSERT_EQ(read.size(), expected.size());
+    for (size_t i = 0; i < read.size(); ++i) ASSERT_EQ(read[i], expected[i]) << "byte " << i;
+}
+
+}
+
+// ----- Escritura y lectura -----
+TEST_F(RegionFileTest, OpenWithoutCreateFailsOnMissingFile) {
+    RegionFile region(_path, ChunkCoord(0, 0));
+    EXPECT_FALSE(region.Open(false));
+    EXPECT_FALSE(region.IsOpen());
+}
+
+TEST_F(RegionFileTest, WritesAndReadsBack) {
+    RegionFile region(_path, ChunkCoord(0, 0));
+    ASSERT_TRUE(region.Open(true));
+    EXPECT_EQ(region.GetSectorCount(), FirstSector);
+
+    DynamicArray<char> a = Payload(100, 1);
+    DynamicArray<char> b = Payload(Sector + 1, 2);
+    ASSERT_TRUE(Write(region, ChunkCoord(0, 0), a));
+    ASSERT_TRUE(Write(region, ChunkCoord(31, 31), b));
+
+    EXPECT_TRUE(region.HasChunk(ChunkCoord(0, 0)));
+    EXPECT_TRUE(region.HasChunk(ChunkCoord(31, 31)));
+    EXPECT_FALSE(region.HasChunk(ChunkCoord(1, 0)));
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 3);
+
+    ExpectPayload(region, ChunkCoord(0, 0), a);
+    ExpectPayload(region, ChunkCoord(31, 31), b);
+
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(0, 0)).sectorOffset, FirstSector);
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(0, 0)).byteLength, 100u);
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(31, 31)).sectorOffset, FirstSector + 1);
+}
+
+// ----- Asignación de sectores -----
+TEST_F(RegionFileTest, FirstFitReusesFreedSectors) {
+    RegionFile region(_path, ChunkCoord(0, 0));
+    ASSERT_TRUE(region.Open(true));
+
+    ASSERT_TRUE(Write(region, ChunkCoord(0, 0), Payload(Sector, 1)));          // 1 sector
+    ASSERT_TRUE(Write(region, ChunkCoord(1, 0), Payload(2 * Sector, 2)));      // 2 sectores
+    ASSERT_TRUE(Write(region, ChunkCoord(2, 0), Payload(10, 3)));              // 1 sector
+    ASSERT_EQ(region.GetSectorCount(), FirstSector + 4);
+
+    ASSERT_TRUE(region.EraseChunk(ChunkCoord(1, 0)));
+
+    // El hueco de dos sectores se reutiliza: el primero para un chunk de un sector...
+    DynamicArray<char> d = Payload(500, 4);
+    ASSERT_TRUE(Write(region, ChunkCoord(3, 0), d));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(3, 0)).sectorOffset, FirstSector + 1);
+
+    // ...y el resto no basta para dos sectores, que van al final
+    ASSERT_TRUE(Write(region, ChunkCoord(4, 0), Payload(Sector + 1, 5)));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(4, 0)).sectorOffset, FirstSector + 4);
+
+    // El sector suelto restante se ocupa con el siguiente chunk pequeño
+    ASSERT_TRUE(Write(region, ChunkCoord(5, 0), Payload(1, 6)));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(5, 0)).sectorOffset, FirstSector + 2);
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 6);
+
+    ExpectPayload(region, ChunkCoord(3, 0), d);
+}
+
+TEST_F(RegionFileTest, GrowingRelocatesAndFreesOldSectors) {
+    RegionFile region(_path, ChunkCoord(0, 0));
+    ASSERT_TRUE(region.Open(true));
+
+    DynamicArray<char> b = Payload(Sector, 2);
+    ASSERT_TRUE(Write(region, ChunkCoord(0, 0), Payload(Sector, 1)));
+    ASSERT_TRUE(Write(region, ChunkCoord(1, 0), b));
+
+    // Tres sectores no caben donde estaba: se escriben al final
+    DynamicArray<char> grown = Payload(3 * Sector, 9);
+    ASSERT_TRUE(Write(region, ChunkCoord(0, 0), grown));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(0, 0)).sectorOffset, FirstSector + 2);
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(0, 0)).byteLength, 3 * Sector);
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 5);
+
+    // El sector anterior queda libre
+    ASSERT_TRUE(Write(region, ChunkCoord(2, 0), Payload(20, 3)));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(2, 0)).sectorOffset, FirstSector);
+
+    ExpectPayload(region, ChunkCoord(0, 0), grown);
+    ExpectPayload(region, ChunkCoord(1, 0), b);
+}
+
+TEST_F(RegionFileTest, ShrinkingRewritesInPlace) {
+    RegionFile region(_path, ChunkCoord(0, 0));
+    ASSERT_TRUE(region.Open(true));
+
+    ASSERT_TRUE(Write(region, ChunkCoord(0, 0), Payload(3 * Sector, 1)));
+    ASSERT_TRUE(Write(region, ChunkCoord(1, 0), Payload(Sector, 2)));
+
+    DynamicArray<char> shrunk = Payload(Sector - 1, 7);
+    ASSERT_TRUE(Write(region, ChunkCoord(0, 0), shrunk));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(0, 0)).sectorOffset, FirstSector);
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(0, 0)).byteLength, Sector - 1);
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 4);
+
+    // Los dos sectores de cola liberados admiten un chunk de dos sectores sin crecer
+    ASSERT_TRUE(Write(region, ChunkCoord(2, 0), Payload(2 * Sector, 3)));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(2, 0)).sectorOffset, FirstSector + 1);
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 4);
+
+    ExpectPayload(region, ChunkCoord(0, 0), shrunk);
+}
+
+TEST_F(RegionFileTest, EraseChunk) {
+    RegionFile region(_path, ChunkCoord(0, 0));
+    ASSERT_TRUE(region.Open(true));
+
+    ASSERT_TRUE(Write(region, ChunkCoord(5, 6), Payload(64, 1)));
+    ASSERT_TRUE(region.EraseChunk(ChunkCoord(5, 6)));
+
+    EXPECT_FALSE(region.HasChunk(ChunkCoord(5, 6)));
+    DynamicArray<char> read;
+    EXPECT_FALSE(region.ReadChunk(ChunkCoord(5, 6), read));
+    EXPECT_FALSE(region.EraseChunk(ChunkCoord(5, 6)));
+    EXPECT_FALSE(region.EraseChunk(ChunkCoord(7, 7)));
+
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(5, 6)).sectorOffset, 0u);
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(5, 6)).byteLength, 0u);
+}
+
+// ----- Reapertura -----
+TEST_F(RegionFileTest, ReopenRestoresChunksAndFreeSectors) {
+    DynamicArray<char> a = Payload(Sector + 10, 1);
+    DynamicArray<char> c = Payload(30, 3);
+    {
+        RegionFile region(_path, ChunkCoord(-1, 2));
+        ASSERT_TRUE(region.Open(true));
+        ASSERT_TRUE(Write(region, ChunkCoord(-32, 64), a));                 // 2 sectores
+        ASSERT_TRUE(Write(region, ChunkCoord(-31, 64), Payload(Sector, 2)));
+        ASSERT_TRUE(Write(region, ChunkCoord(-1, 95), c));
+        ASSERT_TRUE(region.EraseChunk(ChunkCoord(-31, 64)));
+    }
+
+    RegionFile region(_path, ChunkCoord(-1, 2));
+    ASSERT_TRUE(region.Open(false));
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 4);
+
+    EXPECT_TRUE(region.HasChunk(ChunkCoord(-32, 64)));
+    EXPECT_FALSE(region.HasChunk(ChunkCoord(-31, 64)));
+    EXPECT_TRUE(region.HasChunk(ChunkCoord(-1, 95)));
+    ExpectPayload(region, ChunkCoord(-32, 64), a);
+    ExpectPayload(region, ChunkCoord(-1, 95), c);
+
+    // El mapa de sectores se reconstruye desde la tabla: el hueco borrado se reutiliza
+    ASSERT_TRUE(Write(region, ChunkCoord(-30, 64), Payload(8, 4)));
+    region.Flush();
+    EXPECT_EQ(EntryOnDisk(ChunkCoord(-30, 64)).sectorOffset, FirstSector + 2);
+    EXPECT_EQ(region.GetSectorCount(), FirstSector + 4);
+
+    DynamicArray<ChunkCoord> listed;
+    ASSERT_TRUE(RegionFile::ListChunks(_path, ChunkCoord(-1, 2), listed));
+    EXPECT_EQ(listed.size(), 3u);
+}
+
+TEST_F(RegionFileTest, OpenRejectsForeignFile) {
+    {
+        std::ofstream file(_path, std::ios::binary);
+        file << "no es una región";
+    }
+
+    RegionFile region(_path, ChunkCoord(0, 0));
+    EXPECT_FALSE(region.Open(false));
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <algorithm>
+
+#include "map/generator/WorldGenerator.hpp"
+
+// Red de seguridad del determinismo: hashes de referencia del contenido generado para
+// semillas y coordenadas fijas. Si una optimización de WorldGenerator, PerlinNoise o Chunk
+// cambia un hash, los mundos guardados dejan de coincidir con la generación. Actualizar
+// Golden solo si el cambio de mundo es intencionado.
+
+namespace {
+
+struct GenerationCase {
+    const char* name;
+    uint64_t seed;
+    uint32_t chunkSize;
+    float biomeRadius;
+    float metersPerTile;
+    LakeConfig lakes;
+    DynamicArray<int> (*biomeIds)();
+};
+
+DynamicArray<int> SevenBiomes() { return DynamicArray<int>{0, 1, 2, 3, 4, 5, 6}; }
+DynamicArray<int> SparseBiomes() { return DynamicArray<int>{2, 5, 11}; }
+
+const GenerationCase Cases[] = {
+    { "app",      12345,                 128, 500.0f,  1.0f, LakeConfig(0.01f, -0.4f),                       SevenBiomes },
+    { "rios",     7,                     64,  250.0f,  2.0f, LakeConfig(0.012f, -0.35f, 0.003f, 0.06f),      SevenBiomes },
+    { "impar",    0xDEADBEEFCAFEF00Dull, 37,  120.0f,  1.0f, LakeConfig(),                                   SparseBiomes },
+    { "pequeno",  1,                     16,  2000.0f, 2.0f, LakeConfig(0.02f, -0.2f, 0.005f, 0.1f, 30.0f),  SevenBiomes },
+};
+constexpr size_t CaseCount = sizeof(Cases) / sizeof(Cases[0]);
+
+const ChunkCoord Coords[] = {
+    ChunkCoord(0, 0), ChunkCoord(-1, 0), ChunkCoord(0, -1), ChunkCoord(-1, -1),
+    ChunkCoord(1, 1), ChunkCoord(7, -8), ChunkCoord(8, 8), ChunkCoord(-9, 15),
+    ChunkCoord(123, -456), ChunkCoord(-1000, 999), ChunkCoord(5000, -5000), ChunkCoord(-4321, -1234),
+};
+constexpr size_t CoordCount = sizeof(Coords) / sizeof(Coords[0]);
+
+// FNV-1a de los tiles fila a fila (bioma y agua)
+const uint64_t Golden[CaseCount][CoordCount] = {
+    { 0x8B3AACD3F754C6FDull, 0x71A0CA97DA08EF2Full, 0x34B57569525F6325ull, 0x5F744571643AC55Bull,
+      0x34B57569525F6325ull, 0x7823503477732325ull, 0xA9571510C4DD7A89ull, 0xB2C9A9F7FEDC4B86ull,
+      0xD2707AA42ECD9811ull, 0x3C70CBCF88942325ull, 0x30BF9F6AF045619Eull, 0x56A34BC011B6AC40ull },
+    { 0x11D797EE17FB16ADull, 0xF73AC9F190541F2Eull, 0x0E0BA8756855AF87ull, 0xAFF51680A33C6287ull,
+      0xF1546BD9647B28ADull, 0x46A4E77ED320A656ull, 0x3AFBD4E381B17325ull, 0x8F085C28CF2B2BD0ull,
+      0xFB2F2861EB5B242Dull, 0x371DAB1CB5AAF325ull, 0x47973718D9379FEEull, 0x115F64AF2D1C82F3ull },
+    { 0x70D4D75DB71B9C48ull, 0x70D4D75DB71B9C48ull, 0x7F1BF40A4E4DB580ull, 0xF52410983F7B2F87ull,
+      0xFC041BB5E3F66860ull, 0xC3A9A30914A47457ull, 0x82D561098C99402Cull, 0x2013FB1A1BC40915ull,
+      0xE3F72826F1AF2008ull, 0x4D568071AC89FE81ull, 0x5E4AFB2DBBE8F935ull, 0xBF8BA6E43244339Bull },
+    { 0x963548A7B7B20725ull, 0x02EE54A8055F5118ull, 0x963548A7B7B20725ull, 0x02161C41028BF42Dull,
+      0x12B89E8CD49DD4A3ull, 0x9054EBEE119CF2CFull, 0xCC387F5488976725ull, 0xCC387F5488976725ull,
+      0x3C3102EE1E3F0B25ull, 0xAAAF3E5D62468025ull, 0xF1E5943B8E63B82Eull, 0xE81D1F7E6203EB25ull },
+};
+
+uint64_t HashChunk(const Chunk& chunk) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    auto add = [&hash](uint8_t byte) { hash = (hash ^ byte) * 0x100000001B3ull; };
+
+    for (uint32_t y = 0; y < chunk.getChunkSize(); ++y) {
+        const Tile* row = chunk.getRowData(y);
+        for (uint32_t x = 0; x < chunk.getChunkSize(); ++x) {
+            uint32_t biome = static_cast<uint32_t>(row[x].getBiomeId());
+            for (int shift = 0; shift < 32; shift += 8) add(static_cast<uint8_t>(biome >> shift));
+            add(row[x].hasWater() ? 1 : 0);
+        }
+    }
+    return hash;
+}
+
+WorldGenerator MakeGenerator(const GenerationCase& test) {
+    return WorldGenerator(test.biomeIds(), test.lakes, test.seed, test.biomeRadius, test.metersPerTile);
+}
+
+void ExpectGolden(size_t c, size_t i, uint64_t hash, const char* path) {
+    EXPECT_EQ(hash, Golden[c][i]) << path << ": caso " << Cases[c].name << ", chunk ("
+                                  << Coords[i].x() << ", " << Coords[i].y() << "), hash 0x"
+                                  << std::hex << hash << std::dec;
+}
+
+}
+
+// ----- Hashes de referencia -----
+TEST(WorldGenerationTest, MatchesGoldenHashes) {
+    for (size_t c = 0; c < CaseCount; ++c) {
+        WorldGenerator generator = MakeGenerator(Cases[c]);
+        for (size_t i = 0; i < CoordCount; ++i) {
+            ExpectGolden(c, i, HashChunk(*generator.generateChunk(Coords[i], Cases[c].chunkSize)), "generateChunk");
+        }
+    }
+}
+
+TEST(WorldGenerationTest, BatchMatchesGoldenHashes) {
+    for (size_t c = 0; c < CaseCount; ++c) {
+        WorldGenerator generator = MakeGenerator(Cases[c]);
+        DynamicArray<std::unique_ptr<Chunk>> chunks =
+            generator.generateChunks(std::span<const ChunkCoord>(Coords, CoordCount), Cases[c].chunkSize);
+
+        ASSERT_EQ(chunks.size(), CoordCount);
+        for (size_t i = 0; i < CoordCount; ++i) ExpectGolden(c, i, HashChunk(*chunks[i]), "generateChunks");
+    }
+}
+
+// La poda de semillas no puede cambiar el resultado de la regla tile a tile
+TEST(WorldGenerationTest, BiomeAssignmentModesMatchGoldenHashes) {
+    for (size_t c = 0; c < CaseCount; ++c) {
+        WorldGenerator exhaustive = MakeGenerator(Cases[c]);
+        exhaustive.setBiomePruning(false);
+        WorldGenerator flat = MakeGenerator(Cases[c]);
+        flat.setBiomeHierarchy(false);
+
+        for (size_t i = 0; i < CoordCount; ++i) {
+            ExpectGolden(c, i, HashChunk(*exhaustive.generateChunk(Coords[i], Cases[c].chunkSize)), "exhaustiva");
+            ExpectGolden(c, i, HashChunk(*flat.generateChunk(Coords[i], Cases[c].chunkSize)), "poda 8x8");
+        }
+    }
+}
+
+// ----- Independencia del orden -----
+TEST(WorldGenerationTest, ShuffledOrderMatchesGoldenHashes) {
+    std::mt19937 rng(2024);
+    DynamicArray<size_t> order;
+    for (size_t i = 0; i < CoordCount; ++i) order.push_back(i);
+
+    for (size_t c = 0; c < CaseCount; ++c) {
+        // La cache de semillas se llena en otro orden en cada pasada; la pequeña además descarta
+        WorldGenerator generator = MakeGenerator(Cases[c]);
+        WorldGenerator evicting = MakeGenerator(Cases[c]);
+        evicting.getSeedCache()->setCapacity(16);
+
+        for (int pass = 0; pass < 3; ++pass) {
+            std::shuffle(order.data(), order.data() + order.size(), rng);
+            for (size_t i : order) {
+                ExpectGolden(c, i, HashChunk(*generator.generateChunk(Coords[i], Cases[c].chunkSize)), "desordenado");
+                ExpectGolden(c, i, HashChunk(*evicting.generateChunk(Coords[i], Cases[c].chunkSize)), "cache pequeña");
+            }
+        }
+    }
+}
+
+TEST(WorldGenerationTest, MultiThreadedMatchesGoldenHashes) {
+    const size_t threadCount = 4;
+    const int rounds = 3;
+
+    for (size_t c = 0; c < CaseCount; ++c) {
+        WorldGenerator generator = MakeGenerator(Cases[c]);
+        generator.getSeedCache()->setCapacity(64);
+
+        // Cada hilo recorre todas las coordenadas desde un punto y un sentido distintos
+        DynamicArray<uint64_t> hashes(threadCount * rounds * CoordCount, 0);
+        DynamicArray<std::thread> workers;
+        for (size_t t = 0; t < threadCount; ++t) {
+            workers.push_back(std::thread([&, t]() {
+                for (int round = 0; round < rounds; ++round) {
+                    for (size_t k = 0; k < CoordCount; ++k) {
+                        size_t i = (t % 2 == 0) ? (t * 3 + k) % CoordCount : (CoordCount - 1 - (t * 5 + k) % CoordCount);
+                        hashes[(t * rounds + round) * CoordCount + i] =
+                            HashChunk(*generator.generateChunk(Coords[i], Cases[c].chunkSize));
+                    }
+                }
+            }));
+        }
+        for (std::thread& worker : workers) worker.join();
+
+        for (size_t run = 0; run < threadCount * rounds; ++run) {
+            for (size_t i = 0; i < CoordCount; ++i) ExpectGolden(c, i, hashes[run * CoordCount + i], "multihilo");
+        }
+    }
+}
+
+// ----- Rendimiento -----
+// No tiene umbral: informa del rendimiento en la misma ejecución que comprueba los hashes
+TEST(WorldGenerationTest, ReportsThroughput) {
+    const int side = 8;
+
+    DynamicArray<ChunkCoord> block;
+    for (int y = 0; y < side; ++y) {
+        for (int x = 0; x < side; ++x) block.push_back(ChunkCoord(x - side / 2, y - side / 2));
+    }
+
+    for (size_t c = 0; c < CaseCount; ++c) {
+        // Los dos caminos conservan sus chunks, como al cargar un bloque
+        WorldGenerator single = MakeGenerator(Cases[c]);
+        DynamicArray<std::unique_ptr<Chunk>> loaded;
+        loaded.reserve(block.size());
+        auto start = std::chrono::steady_clock::now();
+        for (const ChunkCoord& coord : block) loaded.push_back(single.generateChunk(coord, Cases[c].chunkSize));
+        double singleSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        WorldGenerator batched = MakeGenerator(Cases[c]);
+        start = std::chrono::steady_clock::now();
+        DynamicArray<std::unique_ptr<Chunk>> chunks =
+            batched.generateChunks(std::span<const ChunkCoord>(block.data(), block.size()), Cases[c].chunkSize);
+        double batchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        double tiles = static_cast<double>(block.size()) * Cases[c].chunkSize * Cases[c].chunkSize;
+        std::cout << "[ rendimiento ] " << Cases[c].name << " (" << Cases[c].chunkSize << "x" << Cases[c].chunkSize
+                  << "): generateChunk " << block.size() / singleSeconds << " chunks/s ("
+                  << tiles / singleSeconds * 1e-6 << " Mtiles/s), generateChunks "
+                  << block.size() / batchSeconds << " chunks/s (" << tiles / batchSeconds * 1e-6 << " Mtiles/s)\n";
+
+        ASSERT_EQ(chunks.size(), loaded.size());
+        for (size_t i = 0; i < chunks.size(); ++i) EXPECT_EQ(HashChunk(*chunks[i]), HashChunk(*loaded[i]));
+    }
+}